@@ -0,0 +1 @@
+projects\windows x64 nmake -f projects/makeme-windows-default.nmake %1 %2 %3 %4 %5 %6 %7 %8 %9
@@ -0,0 +1,3 @@
+@echo off
+call %1 %2
+set
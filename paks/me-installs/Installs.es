@@ -6,6 +6,7 @@
 
 module embedthis.me {
 
+require ejs.digest
 require ejs.tar
 require ejs.unix
 require ejs.zlib
@@ -13,6 +14,11 @@ require ejs.zlib
 class InstallsInner {
     let VER_FACTOR = 1000
 
+    /*
+        Incremental staging state for the package being created. Null when installing.
+     */
+    var staging: Object?
+
     function InstallsInner() { }
 
     /*
@@ -83,6 +89,10 @@ class InstallsInner {
                     item.mkdir = [item.mkdir]
                 }
                 item.filelist = filelist
+                if (staging && item.update == null) {
+                    /* Only restage changed files */
+                    item.update = true
+                }
                 if (me.options.verbose) {
                     dump("Consider", item)
                 }
@@ -169,6 +179,17 @@ class InstallsInner {
                     if (item.postPerform) {
                         item.postPerform.call(me.dir.top, item.from, item.to, item)
                     }
+                    if (staging && (item.perform || item.postPerform) && item.to) {
+                        /* Record files the callbacks created so they are not removed as stale */
+                        let to = Path(makeme.loader.expand(item.to))
+                        if (to.isDir) {
+                            for each (file in to.files('**', {exclude: /\/$/})) {
+                                filelist.push(file)
+                            }
+                        } else if (to.exists) {
+                            filelist.push(to)
+                        }
+                    }
                 } catch (e) {
                     print(e)
                     print('WARNING: error with item:')
@@ -189,7 +210,7 @@ class InstallsInner {
                     if (me.target.name != 'uninstall') {
                         let prefix = Path(prefixes[pname])
                         if (pname == 'vapp' || pname == 'web' || pname == 'spool' || pname == 'src' || pname == 'staging') {
-                            if (prefix.exists) {
+                            if (prefix.exists && !(staging && staging.prior)) {
                                 if (prefix.toString().contains(me.settings.name)) {
                                     safeRemove(prefix)
                                 }
@@ -241,6 +262,7 @@ class InstallsInner {
 
     function setupPrefixes(kind, package) {
         let prefixes = {}
+        staging = null
         if (me.installing || me.uninstalling) {
             prefixes = me.prefixes.clone()
             prefixes.staging = me.prefixes.app
@@ -249,7 +271,7 @@ class InstallsInner {
             me.platform.vname = me.settings.name + '-' + me.settings.version
             prefixes.staging = me.dir.pkg.join(kind)
             prefixes.media = prefixes.staging.join(me.platform.vname)
-            safeRemove(prefixes.staging)
+            setupStaging(kind, prefixes)
             for (pname in me.prefixes) {
                 if (package.prefixes.contains(pname)) {
                     if (pname == 'src') {
@@ -267,6 +289,104 @@ class InstallsInner {
         return prefixes
     }
 
+    /*
+        Prepare the staging directory. Staged files are kept between packaging runs and the staging manifest
+        records the digest of each staged file so unchanged packages need not be recreated. Use --rebuild to
+        restage everything.
+     */
+    function setupStaging(kind, prefixes) {
+        let path = me.dir.pkg.join(kind + '.json')
+        let prior
+        if (!me.options.rebuild && !makeme.generating && path.exists && prefixes.staging.exists) {
+            try {
+                prior = path.readJSON()
+            } catch {}
+        }
+        if (!prior) {
+            safeRemove(prefixes.staging)
+            path.remove()
+        }
+        staging = {path: path, prior: prior, started: Math.floor(Date.now() / 1000) * 1000, archives: []}
+    }
+
+    /*
+        Remove stale files from the staging directory and compute the staging manifest. Files that were neither
+        deployed nor modified by the current deployment are left over from earlier packages. Sets staging.changed
+        if the staged files differ from those of the last package.
+     */
+    function updateStaging(prefixes, deployed: Array) {
+        if (!staging) {
+            return
+        }
+        let prior = staging.prior ? staging.prior.files : {}
+        let current = {}
+        for each (file in deployed) {
+            current[Path(file).absolute] = true
+        }
+        let files = {}
+        for each (file in prefixes.staging.files('**', {exclude: /\/$/, missing: undefined})) {
+            let name = file.relativeTo(prefixes.staging).portable
+            /* Test the link itself so links to older files are not seen as stale */
+            let modified = file.linkModified.time
+            if (staging.prior && !current[file.absolute] && modified < staging.started) {
+                vtrace('Remove', 'Stale staged file ' + name)
+                file.remove()
+                continue
+            }
+            let entry = {size: file.size, modified: modified, permissions: file.attributes.permissions}
+            let last = prior[name]
+            if (file.isLink) {
+                entry.link = file.linkTarget.toString()
+            } else if (last && last.sha256 && last.size == entry.size && last.modified == entry.modified) {
+                entry.sha256 = last.sha256
+            } else {
+                entry.sha256 = checksum(file)
+            }
+            files[name] = entry
+        }
+        staging.changed = !staging.prior || !sameStaging(prior, files)
+        staging.files = files
+    }
+
+    function sameStaging(prior, files): Boolean {
+        if (Object.getOwnPropertyCount(prior) != Object.getOwnPropertyCount(files)) {
+            return false
+        }
+        for (let [name, entry] in files) {
+            let last = prior[name]
+            if (!last || last.sha256 != entry.sha256 || last.link != entry.link ||
+                    last.permissions != entry.permissions) {
+                return false
+            }
+        }
+        return true
+    }
+
+    /*
+        Test if an archive was created from the current staged files. Otherwise record it for the staging manifest.
+     */
+    function currentArchive(archive: Path): Boolean {
+        if (!staging) {
+            return false
+        }
+        staging.archives.push(archive.name)
+        if (!staging.changed && archive.exists && staging.prior.archives &&
+                staging.prior.archives.contains(archive.name)) {
+            trace('Current', archive.relativeTo(me.dir.top))
+            return true
+        }
+        return false
+    }
+
+    /*
+        Save the staging manifest after successfully creating packages
+     */
+    function saveStaging() {
+        if (staging && staging.files) {
+            staging.path.write(serialize({files: staging.files, archives: staging.archives}, {pretty: true}) + '\n')
+        }
+    }
+
     public function setupInstall(kind) {
         if (me.settings.manifest) {
             makeme.loader.blendFile(me.dir.top.join(me.settings.manifest))
@@ -309,6 +429,7 @@ class InstallsInner {
             trace('Create', me.settings.title + ' Binary')
             let files = deploy(manifest, package)
             makeFilesLog(prefixes.vapp ? prefixes.vapp : prefixes.app, prefixes.root, files, prefixes)
+            updateStaging(prefixes, files)
             /* Do Tar first as native package will add files */
             let binary = manifest.packages.binary
             if (binary.formats.contains('tar')) {
@@ -317,6 +438,7 @@ class InstallsInner {
             if (binary.formats.contains('native')) {
                 makeNativeInstall(prefixes)
             }
+            saveStaging()
         }
     }
 
@@ -324,8 +446,9 @@ class InstallsInner {
         let [manifest, package, prefixes] = setupInstall('source')
         if (package) {
             trace('Create', me.settings.title + ' Source')
-            deploy(manifest, package)
+            updateStaging(prefixes, deploy(manifest, package))
             makeSimpleInstall(package, prefixes, 'src')
+            saveStaging()
         }
     }
 
@@ -367,8 +490,9 @@ class InstallsInner {
         let [manifest, package, prefixes] = setupInstall('pak')
         if (package) {
             trace('Package', me.settings.title + ' Pak')
-            deploy(manifest, package)
+            updateStaging(prefixes, deploy(manifest, package))
             cacheInstall(package, prefixes, 'pak')
+            saveStaging()
         }
     }
 
@@ -376,8 +500,9 @@ class InstallsInner {
         let [manifest, package, prefixes] = setupInstall('pak')
         if (package) {
             trace('Package', me.settings.title + ' Pak')
-            deploy(manifest, package)
+            updateStaging(prefixes, deploy(manifest, package))
             makeSimpleInstall(package, prefixes, 'pak')
+            saveStaging()
         }
     }
 
@@ -505,6 +630,22 @@ class InstallsInner {
         }
     }
 
+    /*
+        Options for creating package archives. The compression level and thread count can be set via
+        me.settings.compress. Compression uses all CPU cores by default. Uncompressed archives are updated in place.
+     */
+    function tarOptions(prefixes) {
+        let compress = me.settings.compress || {}
+        return {relativeTo: prefixes.staging, user: 'root', group: 'root', uid: 0, gid: 0, digest: true,
+            level: compress.level, threads: (compress.threads != null) ? compress.threads : true, update: true}
+    }
+
+    /*
+        Package archive extension. Set me.settings.compress to false for uncompressed archives.
+     */
+    function tarExt(): String
+        (me.settings.compress === false) ? 'tar' : 'tgz'
+
     function makeSimpleInstall(package, prefixes, fmt) {
     /*
         if (fmt == 'pak') {
@@ -512,18 +653,17 @@ class InstallsInner {
             let package = base.join('package.json')
         }
         */
-        let name = me.dir.rel.join(me.platform.vname + '-' + fmt + '.tar')
-        let zname = name.replaceExt('tgz')
-        let options = {relativeTo: prefixes.staging, user: 'root', group: 'root', uid: 0, gid: 0}
-        let tar = new Tar(name, options)
-        tar.create(prefixes.staging.files('**', {exclude: /\/$/, missing: undefined}))
-        Zlib.compress(tar.name, zname)
-        if (!me.options.keep) {
-            name.remove()
+        let ext = tarExt()
+        let zname = me.dir.rel.join(me.platform.vname + '-' + fmt + '.' + ext)
+        if (currentArchive(zname)) {
+            return
         }
+        let options = tarOptions(prefixes)
+        let tar = new Tar(zname, options)
+        tar.create(prefixes.staging.files('**', {exclude: /\/$/, missing: undefined}))
         trace('Package', zname.relativeTo(me.dir.top))
 
-        let generic = me.dir.rel.join(me.settings.name + '-' + fmt + '.tgz')
+        let generic = me.dir.rel.join(me.settings.name + '-' + fmt + '.' + ext)
         generic.remove()
         if (Config.OS == 'windows') {
             zname.copy(generic)
@@ -531,10 +671,10 @@ class InstallsInner {
             zname.basename.link(generic)
         }
 
-        let sumline = checksum(zname) + ' ' + zname.basename + '\n'
-        me.dir.rel.join('sha256-' + me.platform.vname + '-' + fmt + '.tgz.txt').write(sumline)
-        sumline = md5sum(zname) + ' ' + zname.basename + '\n'
-        me.dir.rel.join('md5-' + me.platform.vname + '-' + fmt + '.tgz.txt').write(sumline)
+        let sumline = tar.digests.sha256 + ' ' + zname.basename + '\n'
+        me.dir.rel.join('sha256-' + me.platform.vname + '-' + fmt + '.' + ext + '.txt').write(sumline)
+        sumline = tar.digests.md5 + ' ' + zname.basename + '\n'
+        me.dir.rel.join('md5-' + me.platform.vname + '-' + fmt + '.' + ext + '.txt').write(sumline)
 
         trace('Package', generic.relativeTo(me.dir.top))
     }
@@ -599,23 +739,27 @@ class InstallsInner {
 
     function makeTarInstall(prefixes) {
         let base = [me.settings.name, me.settings.version, me.platform.dist, me.platform.os, me.platform.arch].join('-')
-        let name = me.dir.rel.join(base).joinExt('tar', true)
-        let zname = name.replaceExt('tgz')
+        let ext = tarExt()
+        let zname = me.dir.rel.join(base).joinExt(ext, true)
+        if (currentArchive(zname)) {
+            return
+        }
         let files = prefixes.staging.files('**', {exclude: /\/$/, missing: undefined})
 
-        let options = {relativeTo: prefixes.staging, user: 'root', group: 'root', uid: 0, gid: 0}
-        let tar = new Tar(name, options)
+        /*
+            Tar, compress and digest in one pass over the staged files
+         */
+        let options = tarOptions(prefixes)
+        let tar = new Tar(zname, options)
         trace('Package', zname.relativeTo(me.dir.top))
         tar.create(files)
-        Zlib.compress(name, zname)
-        name.remove()
 
-        let sumline = checksum(zname) + ' ' + zname.basename + '\n'
-        me.dir.rel.join('sha256-' + base).joinExt('tgz.txt', true).write(sumline)
-        sumline = md5sum(zname) + ' ' + zname.basename + '\n'
-        me.dir.rel.join('md5-' + base).joinExt('tgz.txt', true).write(sumline)
+        let sumline = tar.digests.sha256 + ' ' + zname.basename + '\n'
+        me.dir.rel.join('sha256-' + base).joinExt(ext + '.txt', true).write(sumline)
+        sumline = tar.digests.md5 + ' ' + zname.basename + '\n'
+        me.dir.rel.join('md5-' + base).joinExt(ext + '.txt', true).write(sumline)
 
-        let generic = me.dir.rel.join(me.settings.name + '-tar' + '.tgz')
+        let generic = me.dir.rel.join(me.settings.name + '-tar.' + ext)
         generic.remove()
         if (Config.OS == 'windows') {
             zname.copy(generic)
@@ -981,18 +1125,12 @@ class InstallsInner {
         return (((major * VER_FACTOR) + minor) * VER_FACTOR) + patch
     }
 
-    function checksum(filename) {
-        if (Config.OS == 'windows') {
-            return(Cmd.run('sha256sum ' + filename).split(' ')[0])
-        } else if (Cmd.locate('sha256sum')) {
-            return(Cmd.run('sha256sum ' + filename).split(' ')[0])
-        } else {
-            return(Cmd.run('shasum -a 256 ' + filename).split(' ')[0])
-        }
+    function checksum(filename: Path): String {
+        return Digest.file(filename, 'sha256')
     }
 
-    function md5sum(filename: Path) {
-        return md5(filename.readString())
+    function md5sum(filename: Path): String {
+        return Digest.file(filename, 'md5')
     }
 
 } /* InstallsInner class */
@@ -19,6 +19,11 @@ class Make {
 
     var targetsToClean = { exe: true, file: true, lib: true, obj: true }
 
+    /*
+        Output directories created by directory rules in generated Makefiles
+     */
+    var buildDirs = [ '$(BUILD)/bin', '$(BUILD)/inc', '$(BUILD)/obj' ]
+
     public function Make() {
         loader = makeme.loader
         builder = makeme.builder
@@ -289,7 +294,7 @@ class Make {
                 if (solo) {
                     genTargetDeps(target)
                     let path = target.path
-                    genWrite(reppath(path) + ':' + getDepsVar() + '\n')
+                    genWrite(reppath(path) + ':' + getDepsVar() + orderOnly(path) + '\n')
                 }
                 makeDir(target.mkdir)
             }
@@ -313,7 +318,7 @@ class Make {
             genTargetDeps(target)
             command = genTargetLibs(target, repcmd(command))
             command = command.replace(/-arch *\S* /, '-arch $$(CC_ARCH) ')
-            genWrite(reppath(target.path) + ':' + getDepsVar() + '\n')
+            genWrite(reppath(target.path) + ':' + getDepsVar() + orderOnly(target.path) + '\n')
             genPathTrace('Link', target.path.natural.relative)
             generateDir(target)
             if (generating == 'nmake') {
@@ -398,8 +403,10 @@ class Make {
 
         genWriteLine('unexport CDPATH\n')
         genWriteLine('ifndef SHOW\n.SILENT:\nendif\n')
+        /* Objects order after $(HEADERS) which is only complete once the whole Makefile has been read */
+        genWriteLine('.SECONDEXPANSION:\n')
         genWriteLine('all build compile: prep $(TARGETS)\n')
-        genWriteLine('.PHONY: prep\n\nprep:')
+        genWriteLine('.PHONY: prep\n\nprep: | ' + buildDirs.join(' '))
         genWriteLine('\t@echo "      [Info] Use "make SHOW=1" to trace executed commands."')
         genWriteLine('\t@if [ "$(CONFIG)" = "" ] ; then echo WARNING: CONFIG not set ; exit 255 ; fi')
         if (me.prefixes.app) {
@@ -410,15 +417,6 @@ class Make {
             genWriteLine('\t@if [ "$(WIND_HOST_TYPE)" = "" ] ; then echo WARNING: WIND_HOST_TYPE not set. Run wrenv.sh. ; exit 255 ; fi')
             genWriteLine('\t@if [ "$(WIND_GNU_PATH)" = "" ] ; then echo WARNING: WIND_GNU_PATH not set. Run wrenv.sh. ; exit 255 ; fi')
         }
-        genWriteLine('\t@[ ! -x $(BUILD)/bin ] && ' + 'mkdir -p $(BUILD)/bin; true')
-        genWriteLine('\t@[ ! -x $(BUILD)/inc ] && ' + 'mkdir -p $(BUILD)/inc; true')
-        genWriteLine('\t@[ ! -x $(BUILD)/obj ] && ' + 'mkdir -p $(BUILD)/obj; true')
-        if (me.dir.inc.join('me.h').exists) {
-            genWriteLine('\t@[ ! -f $(BUILD)/inc/me.h ] && ' + 'cp projects/' + pop + '-me.h $(BUILD)/inc/me.h ; true')
-            genWriteLine('\t@if ! diff $(BUILD)/inc/me.h projects/' + pop + '-me.h >/dev/null ; then\\')
-            genWriteLine('\t\tcp projects/' + pop + '-me.h $(BUILD)/inc/me.h  ; \\')
-            genWriteLine('\tfi; true')
-        }
         genWriteLine('\t@if [ -f "$(BUILD)/.makeflags" ] ; then \\')
         genWriteLine('\t\tif [ "$(MAKEFLAGS)" != "`cat $(BUILD)/.makeflags`" ] ; then \\')
         genWriteLine('\t\t\techo "   [Warning] Make flags have changed since the last build" ; \\')
@@ -427,6 +425,17 @@ class Make {
         genWriteLine('\tfi')
         genWriteLine('\t@echo "$(MAKEFLAGS)" >$(BUILD)/.makeflags\n')
 
+        /*
+            Directories and me.h are real targets (not made by prep) so "make -j" builds them before their users
+         */
+        genWriteLine(buildDirs.join(' ') + ':\n\tmkdir -p $@\n')
+        if (me.dir.inc.join('me.h').exists) {
+            genWriteLine('$(BUILD)/inc/me.h: projects/' + pop + '-me.h | $(BUILD)/inc')
+            genWriteLine('\t@if ! diff $@ projects/' + pop + '-me.h >/dev/null 2>&1 ; then \\')
+            genWriteLine('\t\tcp projects/' + pop + '-me.h $@ ; \\')
+            genWriteLine('\tfi\n')
+        }
+
         genWriteLine('clean:')
         builtin('cleanTargets')
         genWriteLine('\nclobber: clean\n\trm -fr ./$(BUILD)\n')
@@ -772,7 +781,7 @@ class Make {
             genTargetDeps(target)
             command = genTargetLibs(target, repcmd(command))
             command = command.replace(/-arch *\S* /, '-arch $$(CC_ARCH) ')
-            genWrite(reppath(target.path) + ':' + getDepsVar() + '\n')
+            genWrite(reppath(target.path) + ':' + getDepsVar() + orderOnly(target.path) + '\n')
             genPathTrace('Link', target.path.natural.relative)
             generateDir(target)
             if (generating == 'nmake') {
@@ -798,7 +807,7 @@ class Make {
         } else if (generating == 'make' || generating == 'nmake') {
             command = repcmd(command)
             genTargetDeps(target)
-            genWrite(reppath(target.path) + ':' + getDepsVar() + '\n')
+            genWrite(reppath(target.path) + ':' + getDepsVar() + orderOnly(target.path) + '\n')
             genPathTrace('Link', target.path.natural.relative)
             generateDir(target)
             if (generating == 'nmake') {
@@ -844,7 +853,8 @@ class Make {
                 command = repcmd(command)
                 command = command.replace(/-arch *\S* /, '-arch $$(CC_ARCH) ')
                 genTargetDeps(target)
-                genWrite(reppath(target.path) + ': \\\n    ' + file.relative + getDepsVar() + '\n')
+                genWrite(reppath(target.path) + ': \\\n    ' + file.relative + getDepsVar() + orderOnly(target.path, '$$(HEADERS)') +
+                    '\n')
                 genPathTrace('Compile', target.path.natural.relative)
                 generateDir(target)
                 genWriteLine('\t' + command)
@@ -883,7 +893,8 @@ class Make {
             } else if (generating == 'make') {
                 command = repcmd(command)
                 genTargetDeps(target)
-                genWrite(reppath(target.path) + ': \\\n        ' + file.relative + getDepsVar() + '\n')
+                genWrite(reppath(target.path) + ': \\\n        ' + file.relative + getDepsVar() + orderOnly(target.path) +
+                    '\n')
                 genPathTrace('Compile', target.path.natural.relative)
                 generateDir(target)
                 genWriteLine('\t' + command)
@@ -906,9 +917,9 @@ class Make {
         if (generating == 'make' || generating == 'nmake') {
             genTargetDeps(target)
             if (target.modify) {
-                genWrite(reppath(target.modify) + ':' + getDepsVar() + '\n')
+                genWrite(reppath(target.modify) + ':' + getDepsVar() + orderOnly(target.modify) + '\n')
             } else {
-                genWrite(reppath(target.path) + ':' + getDepsVar() + '\n')
+                genWrite(reppath(target.path) + ':' + getDepsVar() + orderOnly(target.path) + '\n')
             }
         }
         let dest = target.path
@@ -1266,6 +1277,21 @@ class Make {
         return command
     }
 
+    /*
+        Order-only prerequisites on the output directory and any other items. Make builds these first without
+        rebuilding the target when their timestamps change.
+     */
+    function orderOnly(path: Path, ...items): String {
+        if (generating != 'make') {
+            return ''
+        }
+        let dir = reppath(path.dirname)
+        if (buildDirs.contains(dir)) {
+            items.unshift(dir)
+        }
+        return (items.length > 0) ? (' | ' + items.join(' ')) : ''
+    }
+
     function getDepsVar(target)  {
         return ' $(DEPS_' + nextID + ')'
     }
@@ -1364,6 +1390,9 @@ class Make {
             }
         }
         genTargetDepItems(target, depends)
+        if (generating == 'make' && target.type == 'header') {
+            genWriteLine('HEADERS += ' + reppath(target.modify || target.path))
+        }
         genWriteLine('')
     }
 
@@ -0,0 +1,391 @@
+/*
+    Ninja.es -- Generate Ninja build files
+
+    Ninja files are generated from the configured target graph. Unlike Makefiles, they do not have conditional
+    component sections. Compiler dependencies are tracked via depfiles and exported headers are only copied if they
+    have changed (restat) so dependent objects are not needlessly rebuilt.
+
+    Copyright (c) All Rights Reserved. See copyright notice at the bottom of the file.
+ */
+module embedthis.me {
+
+class Ninja {
+
+    var builder: Builder
+    var loader: Loader
+    var options: Object
+
+    /* Outputs with build edges. Ninja permits only one edge per output */
+    var emitted: Object
+    var headers: Array
+
+    public function Ninja() {
+        loader = makeme.loader
+        builder = makeme.builder
+        options = makeme.options
+    }
+
+    public function generate(base: Path) {
+        if (me.platform.like == 'windows') {
+            throw 'Ninja generation is not supported for ' + me.platform.os + '. Use nmake or vs'
+        }
+        trace('Generate', 'project file: ' + base.relative + '.ninja')
+        emitted = {}
+        headers = []
+        let path = base.joinExt('ninja')
+        genOpen(path)
+        genWriteLine('#\n#   ' + path.basename + ' -- Ninja build file to build ' +
+            me.settings.title + ' for ' + me.platform.os + '\n#')
+        genWriteLine('#   Build from the top directory via: ninja -f ' + path.relative + '\n#\n')
+        genWriteLine('ninja_required_version = 1.3\n')
+        variables()
+        rules()
+
+        let pop = me.settings.name + '-' + me.platform.os + '-' + me.platform.profile
+        if (me.dir.inc.join('me.h').exists) {
+            let header = escapePath(me.dir.inc.join('me.h'))
+            edge(header, 'header', ['projects/' + pop + '-me.h'])
+            headers.push(header)
+        }
+        builder.build(['gen'])
+
+        genWriteLine('#\n#   Objects are ordered after exported headers. Thereafter, depfiles track header use.\n#')
+        genWriteLine('build headers: phony ' + headers.join(' ') + '\n')
+        let all = []
+        for each (target in builder.topTargets) {
+            let out = output(target)
+            if (target.enable && target.generate && (target.modify || target.path) && emitted[out]) {
+                all.push(out)
+            }
+        }
+        if (!emitted.all) {
+            genWriteLine('build all: phony ' + all.join(' ') + '\n')
+        }
+        genWriteLine('default all')
+        genClose()
+    }
+
+    public function generateTarget(target) {
+        if (!target.enable || (target.type == 'component' && !target.generate)) {
+            return
+        }
+        global.TARGET = me.target = target
+        if (target.type == 'lib') {
+            generateLink(target, target.static ? 'lib' : 'shlib')
+        } else if (target.type == 'exe') {
+            generateLink(target, 'exe')
+        } else if (target.type == 'obj') {
+            generateObj(target)
+        } else if (target.type == 'file' || target.type == 'header') {
+            generateFile(target)
+        } else if (target.type == 'resource') {
+            throw 'Ninja generation does not support resource targets'
+        } else if (target.mkdir || target.generate) {
+            generateScript(target)
+        }
+        global.TARGET = me.target = null
+    }
+
+    /*
+        Emit variable definitions. Ninja variables are expanded when defined, so order matters.
+        Flags are the configured flags as Ninja files do not select debug or release builds.
+     */
+    function variables() {
+        let mappings = makeme.generate.mappings
+        let cpack = me.targets.compiler
+        genWriteLine('%-21s = %s'.format(['NAME', me.settings.name]))
+        genWriteLine('%-21s = %s'.format(['VERSION', me.settings.version]) + '\n')
+        for each (item in mapPrefixes()) {
+            genRawWriteLine('%-21s = %s'.format(['ME_' + item.name.toUpper() + '_PREFIX', item.value]))
+        }
+        genWriteLine('')
+        genRawWriteLine('%-21s = %s'.format(['CONFIG', me.platform.name]))
+        genWriteLine('%-21s = %s'.format(['BUILD', loader.BUILD + '/${CONFIG}']))
+        genWriteLine('%-21s = %s'.format(['LBIN', '${BUILD}/bin']))
+        genWriteLine('%-21s = %s'.format(['CC', me.targets.compiler.path]))
+        if (me.targets.link) {
+            genWriteLine('%-21s = %s'.format(['LD', me.targets.link.path]))
+        }
+        genWriteLine('%-21s = %s'.format(['CFLAGS', cpack.compiler.join(' ')]))
+        genWriteLine('%-21s = %s'.format(['DFLAGS', mappings.defines]))
+        genWriteLine('%-21s = %s'.format(['IFLAGS', cpack.includes.map(function(path) '-I' + reppath(path)).join(' ')]))
+        let linker = cpack.linker.map(function(s) "'" + s + "'").join(' ')
+        genWriteLine('%-21s = %s'.format(['LDFLAGS', escape(repvar(linker))]))
+        genWriteLine('%-21s = %s'.format(['LIBPATHS', repvar(mappings.libpaths)]))
+        genWriteLine('%-21s = %s'.format(['LIBS', mappings.libraries]) + '\n')
+    }
+
+    function rules() {
+        genWriteLine('rule cc\n    command = $command -MMD -MF $out.d\n    depfile = $out.d\n    deps = gcc\n' +
+            '    description = [Compile] $out\n')
+        genWriteLine('rule link\n    command = $command\n    description = [Link] $out\n')
+        genWriteLine('rule header\n    command = cmp -s $in $out || cp $in $out\n    restat = 1\n' +
+            '    description = [Copy] $out\n')
+        genWriteLine('rule copy\n    command = $command\n    description = [Copy] $out\n')
+        genWriteLine('rule script\n    command = export PATH="$$PWD/${LBIN}:$$PATH" ; $command\n' +
+            '    description = $desc\n')
+    }
+
+    /*
+        Installation prefixes in definition order. Prefixes are defined relative to their parent prefix.
+     */
+    function mapPrefixes(): Array {
+        let root = me.prefixes.root
+        let base = me.prefixes.base
+        let app = me.prefixes.app
+        let vapp = me.prefixes.vapp
+        let result = []
+        for (let [name, value] in me.prefixes) {
+            if (name.startsWith('programFiles')) continue
+            value = loader.expand(value).replace(/\/\//g, '/')
+            if (name == 'root') {
+                if (value == '/') {
+                    value = ''
+                }
+            } else if (name == 'base') {
+                if (value.startsWith(root.name)) {
+                    value = value.replace(root.name, (root.name == '/') ? '${ME_ROOT_PREFIX}/' : '${ME_ROOT_PREFIX}')
+                } else {
+                    value = '${ME_ROOT_PREFIX}' + value
+                }
+            } else if (name == 'app') {
+                if (value.startsWith(base.name)) {
+                    value = value.replace(base.name, '${ME_BASE_PREFIX}')
+                }
+            } else if (name == 'vapp') {
+                if (value.startsWith(app.name)) {
+                    value = value.replace(app.name, '${ME_APP_PREFIX}')
+                }
+            } else if (value.startsWith(vapp.name)) {
+                value = value.replace(vapp.name, '${ME_VAPP_PREFIX}')
+            } else {
+                value = '${ME_ROOT_PREFIX}' + value
+            }
+            value = value.replace(me.settings.version, '${VERSION}')
+            value = value.replace(me.settings.name, '${NAME}')
+            result.push({name: name, value: value})
+        }
+        let first = []
+        for each (name in ['root', 'base', 'app', 'vapp']) {
+            first += result.filter(function(item) item.name == name)
+        }
+        return first + result.filter(function(item) !first.contains(item))
+    }
+
+    function generateLink(target, transition) {
+        transition = target.rule || transition
+        let rule = me.rules[transition]
+        if (!rule) {
+            throw 'No rule to build target ' + target.path + ' for transition ' + transition
+        }
+        let command = escape(repcmd(builder.expandRule(target, rule)))
+        edge(output(target), 'link', [], depends(target), [], {command: command})
+    }
+
+    /*
+        Build an object from source
+     */
+    function generateObj(target) {
+        builder.runTargetScript(target, 'precompile')
+        for each (file in target.files) {
+            target.vars.INPUT = file.relative
+            let transition = file.extension + '->' + target.path.extension
+            let rule = target.rule || me.rules[transition]
+            if (!rule) {
+                rule = me.rules[target.path.extension]
+                if (!rule) {
+                    throw 'No rule to build target ' + target.path + ' for transition ' + transition
+                }
+            }
+            let command = escape(repcmd(builder.expandRule(target, rule)))
+            edge(escapePath(target.path), 'cc', [escapePath(file)], depends(target), ['headers'], {command: command})
+        }
+        builder.runTargetScript(target, 'postcompile')
+    }
+
+    /*
+        Copy files[] to path. Single exported headers use the "header" rule which preserves unchanged headers.
+     */
+    function generateFile(target) {
+        let out = output(target)
+        if (emitted[out] || target.files.length == 0) {
+            return
+        }
+        let implicit = depends(target)
+        if (target.type == 'header' && target.files.length == 1 && !target.modify && !target.path.isDir) {
+            edge(out, 'header', [escapePath(target.files[0])], implicit)
+            headers.push(out)
+            return
+        }
+        for each (file in target.files) {
+            if (file != target.path) {
+                implicit.push(escapePath(file))
+            }
+        }
+        genStartCapture(target)
+        if (target.mkdir) {
+            makeDir(target.mkdir)
+        }
+        copyFiles(target.files, target.path, target)
+        if (target.modify) {
+            touchFile(target.modify.relativeTo(me.dir.top))
+        }
+        /* Pass a bare object so the message is not echoed. Ninja prints the edge description instead. */
+        let command = commandLine(genStopCapture({}))
+        edge(out, 'copy', [], implicit, [], {command: command})
+        if (target.type == 'header') {
+            headers.push(out)
+        }
+    }
+
+    /*
+        Strategy: If target.generate is true, then run script and capture commands
+        otherwise, interpret generate* as a command. Ninja runs commands via /bin/sh so these are tried in order:
+            generate-ninja-OS
+            generate-ninja
+            generate-sh
+            generate
+     */
+    function generateScript(target) {
+        builder.setRuleVars(target, target.home)
+        let out = output(target)
+        let cmd = target['generate-ninja-' + me.platform.os] || target['generate-ninja'] || target['generate-sh'] || ''
+        if (!cmd && target.generate is String) {
+            cmd = target.generate
+        }
+        genStartCapture(target)
+        if (target.mkdir) {
+            makeDir(target.mkdir)
+        }
+        if (target.generate === true && !cmd) {
+            builder.runTargetScript(target, 'build')
+            cmd = genStopCapture({})
+        } else {
+            let mkdirs = genStopCapture({})
+            if (cmd) {
+                cmd = loader.expand(cmd, {missing: null}).expand(target.vars, {missing: true})
+                cmd = repvar2(cmd, target.home)
+            }
+            cmd = (mkdirs && cmd) ? (mkdirs + '\n' + cmd) : (mkdirs || cmd)
+        }
+        let implicit = depends(target)
+        for each (file in target.files) {
+            implicit.push(escapePath(file))
+        }
+        cmd = commandLine(cmd)
+        if (!cmd) {
+            if (!target.path) {
+                /* Aggregate target. Permits "ninja NAME" */
+                edge(out, 'phony', [], implicit)
+            }
+            return
+        }
+        if (!target.home.same('.')) {
+            cmd = 'cd ' + target.home.relative + ' && ' + cmd
+        }
+        let desc = '[Run] ' + target.name
+        if (target.message) {
+            let message = target.message
+            if (message is Array) {
+                desc = '[' + message[0] + '] ' + message.slice(1).join(' ')
+            } else if (message.contains(':')) {
+                let [, tag, msg] = message.match(/([^:]*) *: *(.*)/)
+                desc = '[' + tag + '] ' + msg
+            } else {
+                desc = '[Info] ' + message
+            }
+            desc = escape(repvar(loader.expand(desc)))
+        }
+        edge(out, 'script', [], implicit, [], {command: cmd, desc: desc})
+    }
+
+    /*
+        Convert captured or scripted shell commands to a single command line
+     */
+    function commandLine(cmd): String {
+        if (!cmd) {
+            return ''
+        }
+        let result = ''
+        for each (line in cmd.toString().replace(/\\\n\s*/g, ' ').split('\n')) {
+            line = line.trim().replace(/^@/, '')
+            if (line == '') {
+                continue
+            }
+            if (result && !result.match(/(;|&&|\|\||\||\bthen|\bdo|\belse|\{)$/)) {
+                result += ' ;'
+            }
+            result += (result ? ' ' : '') + line
+        }
+        return escape(result.replace(/ +/g, ' '))
+    }
+
+    /*
+        Outputs of the targets this target depends upon. Components are transparent.
+     */
+    function depends(target, list: Array = [], names: Array? = null): Array {
+        names ||= (target.depends + target.uses)
+        for each (dname in names) {
+            if (dname == target.name) {
+                continue
+            }
+            let dep = builder.getDep(dname)
+            if (!dep || !dep.enable) {
+                continue
+            }
+            if (dep.type == 'component') {
+                depends(target, list, (dep.depends || []) + (dep.uses || []))
+            } else {
+                let out = output(dep)
+                if (emitted[out] && !list.contains(out)) {
+                    list.push(out)
+                }
+            }
+        }
+        return list
+    }
+
+    function edge(out: String, rule: String, inputs: Array, implicit: Array = [], order: Array = [], vars = {}) {
+        let line = 'build ' + out + ': ' + rule
+        if (inputs.length > 0) {
+            line += ' ' + inputs.join(' ')
+        }
+        if (implicit.length > 0) {
+            line += ' | ' + implicit.join(' ')
+        }
+        if (order.length > 0) {
+            line += ' || ' + order.join(' ')
+        }
+        genWriteLine(line)
+        for (let [key, value] in vars) {
+            genWriteLine('    ' + key + ' = ' + value)
+        }
+        genWriteLine('')
+        emitted[out] = true
+    }
+
+    /*
+        Escape "$" except for ${VAR} references emitted by repcmd and repvar
+     */
+    function escape(s: String): String
+        s.replace(/\$(?!\{)/g, '$$$$')
+
+    function escapePath(path: Path): String
+        escape(reppath(path)).replace(/([ :])/g, '$$$1')
+
+    function output(target): String {
+        let path = target.modify || target.path
+        return path ? escapePath(path) : target.name
+    }
+
+} /* class Ninja */
+
+} /* embedthis.me module */
+
+/*
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+ */
@@ -1035,6 +1035,9 @@ DEPS_51 += paks/me-installs/pak.json
 DEPS_51 += paks/me-make/Make.es
 DEPS_51 += paks/me-make/make.me
 DEPS_51 += paks/me-make/pak.json
+DEPS_51 += paks/me-ninja/Ninja.es
+DEPS_51 += paks/me-ninja/ninja.me
+DEPS_51 += paks/me-ninja/pak.json
 DEPS_51 += paks/me-os/freebsd.me
 DEPS_51 += paks/me-os/gcc.me
 DEPS_51 += paks/me-os/linux.me
@@ -1077,6 +1080,10 @@ $(BUILD)/.pakrun-modified: $(DEPS_51)
 	cp paks/me-make/Make.es $(BUILD)/bin/paks/me-make/Make.es
 	cp paks/me-make/make.me $(BUILD)/bin/paks/me-make/make.me
 	cp paks/me-make/pak.json $(BUILD)/bin/paks/me-make/pak.json
+	mkdir -p "$(BUILD)/bin/paks/me-ninja"
+	cp paks/me-ninja/Ninja.es $(BUILD)/bin/paks/me-ninja/Ninja.es
+	cp paks/me-ninja/ninja.me $(BUILD)/bin/paks/me-ninja/ninja.me
+	cp paks/me-ninja/pak.json $(BUILD)/bin/paks/me-ninja/pak.json
 	mkdir -p "$(BUILD)/bin/paks/me-os"
 	cp paks/me-os/freebsd.me $(BUILD)/bin/paks/me-os/freebsd.me
 	cp paks/me-os/gcc.me $(BUILD)/bin/paks/me-os/gcc.me
@@ -1393,6 +1400,12 @@ installBinary: $(DEPS_59)
 	cp paks/me-make/README.md $(ME_VAPP_PREFIX)/bin/paks/me-make/README.md ; \
 	cp paks/me-make/make.me $(ME_VAPP_PREFIX)/bin/paks/me-make/make.me ; \
 	cp paks/me-make/pak.json $(ME_VAPP_PREFIX)/bin/paks/me-make/pak.json ; \
+	mkdir -p "$(ME_VAPP_PREFIX)/bin/paks/me-ninja" ; \
+	cp paks/me-ninja/LICENSE.md $(ME_VAPP_PREFIX)/bin/paks/me-ninja/LICENSE.md ; \
+	cp paks/me-ninja/Ninja.es $(ME_VAPP_PREFIX)/bin/paks/me-ninja/Ninja.es ; \
+	cp paks/me-ninja/README.md $(ME_VAPP_PREFIX)/bin/paks/me-ninja/README.md ; \
+	cp paks/me-ninja/ninja.me $(ME_VAPP_PREFIX)/bin/paks/me-ninja/ninja.me ; \
+	cp paks/me-ninja/pak.json $(ME_VAPP_PREFIX)/bin/paks/me-ninja/pak.json ; \
 	mkdir -p "$(ME_VAPP_PREFIX)/bin/paks/me-os" ; \
 	cp paks/me-os/LICENSE.md $(ME_VAPP_PREFIX)/bin/paks/me-os/LICENSE.md ; \
 	cp paks/me-os/README.md $(ME_VAPP_PREFIX)/bin/paks/me-os/README.md ; \
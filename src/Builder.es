@@ -5,6 +5,7 @@
  */
 module embedthis.me {
 
+require ejs.digest
 require ejs.unix
 require ejs.zlib
 require ejs.version
@@ -25,16 +26,29 @@ public class Builder {
     /** List of targets to clean by default. Defaults to 'exe', 'file', 'lib' and 'obj' */
     public static const TargetsToClean = { exe: true, file: true, lib: true, obj: true }
 
+    /** Command log in the platform output directory. Records each command run and is summarized by "me --stats" */
+    public static const CommandLog = 'commands.log'
+
+    /** Size at which the command log is restarted */
+    public static const CommandLogLimit = 16 * 1024 * 1024
+
+    /** Maximum number of remote compile jobs in flight per worker */
+    public static const RemoteJobs = 8
+
     /** Current goal */
     public var goal: String
 
     /** Top-level targets to build */
     public var topTargets: Array
 
+    private var buildStarted: Number = Date.now()
+    private var commandLogs: Object = {}
+    private var depTargets: Object = {}
     private var expandMissing = undefined
     private var gates: Object = {}
     private var loader: Loader
     private var options: Object
+    private var remote: Object
     private var selectedTargets: Array
 
     /** Builder constructor
@@ -75,13 +89,24 @@ public class Builder {
             makeDirs()
         }
         let save = gates['build']
-        for each (goal in goals) {
-            vtrace('Build', goal)
-            admitSetup('build')
-            this.goal = goal
-            for each (target in selectTargets(goal)) {
-                buildTarget(target)
+        remote = { next: 0, pending: [] }
+        if (!options.pgo) {
+            /* Profile data is local and is not part of the object cache key */
+            remote.workers = options.workers || me.settings.workers
+            remote.cache = cacheSettings()
+        }
+        try {
+            for each (goal in goals) {
+                vtrace('Build', goal)
+                admitSetup('build')
+                this.goal = goal
+                for each (target in selectTargets(goal)) {
+                    buildTarget(target)
+                }
             }
+            waitRemote()
+        } finally {
+            closeRemote()
         }
         gates['build'] = save
     }
@@ -114,6 +139,10 @@ public class Builder {
             App.log.error('Possible recursive dependancy: target ' + target.name + ' is already building')
             return
         }
+        if (target.type != 'obj') {
+            /* Objects compiled remotely must be complete before other targets can test or use them */
+            waitRemote()
+        }
         global.TARGET = me.target = target
 
         if (target.files) {
@@ -199,7 +228,7 @@ public class Builder {
         } else {
             safeRemove(target.path)
         }
-        run(command, {filter: /Creating library /})
+        run(command, {filter: /Creating library /, rule: transition})
     }
 
     /*
@@ -251,15 +280,306 @@ public class Builder {
             }
             let command = expandRule(target, rule)
             trace('Compile', target.path.natural.relative)
+            if ((remote.workers || remote.cache) && transition == 'c->o' && !target.rule &&
+                    remoteCompile(target, command)) {
+                continue
+            }
             if (me.platform.os == 'windows') {
-                run(command, {filter: /^[a-zA-Z0-9-]*.c\s*$/})
+                run(command, {filter: /^[a-zA-Z0-9-]*.c\s*$/, rule: transition})
             } else {
-                run(command)
+                run(command, {rule: transition})
             }
         }
         runTargetScript(target, 'postcompile')
     }
 
+    /*
+        Compile a C source via the object cache and remote "me --worker" compile workers. The source is preprocessed
+        locally with the 'c->c' rule. The object is keyed by a digest of the preprocessed source, the compiler identity
+        and the 'c->o' command to compile it as job.i into job.o. Tree paths in line markers are made relative. Cached
+        objects are copied from the local cache directory or fetched from the remote cache. Otherwise the job is posted
+        to a worker which compiles in the background and the object is written by waitRemote. Returns false if the
+        source must be compiled locally.
+     */
+    function remoteCompile(target, command: String): Boolean {
+        let scripts = target.scripts
+        if (me.platform.like == 'windows' || !me.rules['c->c'] ||
+                (scripts && (scripts.postcompile || scripts.postbuild))) {
+            return false
+        }
+        if (command.contains('-gsplit-dwarf')) {
+            /* The split debug info is written beside the object and is not returned by workers or the cache */
+            return false
+        }
+        let workers = remote.workers
+        while (workers && remote.pending.length >= workers.length * RemoteJobs) {
+            finishRemote(remote.pending.shift())
+        }
+        let source = run(expandRule(target, me.rules['c->c']), {filter: true, noshow: true, rule: 'c->c'})
+        let vars = blend({}, target.vars)
+        vars.INPUT = 'job.i'
+        vars.OUTPUT = 'job.o'
+        vars.DEFINES = ''
+        vars.INCLUDES = ''
+        let job = {
+            target: target,
+            path: target.path,
+            command: command,
+            compile: loader.expand(me.rules['c->o']).expand(vars, {missing: ''}),
+        }
+        let compiler = me.targets.compiler.path
+        remote.identity ||= MakeMe.compilerIdentity(compiler)
+        if (remote.cache) {
+            /*
+                Key without the compiler location or the tree location in line markers so other checkouts share objects.
+                Objects from another checkout may contain that checkout's paths in their debug info.
+             */
+            let text = job.compile.replace(compiler.toString(), compiler.basename.toString())
+            job.key = Digest().update(text, '\n', remote.identity, '\n',
+                source.split(' "' + me.dir.top + '/').join(' "')).digest()
+            if (fetchObject(job)) {
+                return true
+            }
+        }
+        let spec = workers ? workerJob(job.compile) : null
+        if (!spec) {
+            run(command, {rule: 'c->o'})
+            storeObject(job)
+            return true
+        }
+        job.worker = workers[remote.next++ % workers.length]
+        job.http = new Http
+        if (options.show) {
+            trace('Remote', job.worker + ': ' + spec.compiler + ' ' + spec.flags.join(' '))
+        }
+        try {
+            job.http.setLimits(MakeMe.WorkerLimits)
+            job.http.setHeader('Content-Type', 'application/octet-stream')
+            job.http.setHeader('X-MakeMe-Compiler', spec.compiler)
+            job.http.setHeader('X-MakeMe-Identity', remote.identity)
+            job.http.setHeader('X-MakeMe-Flags', serialize(spec.flags))
+            job.http.post('http://' + job.worker + '/compile', source)
+        } catch (e) {
+            job.http.close()
+            trace('Warn', 'Cannot send compile job to worker ' + job.worker + ', compiling locally')
+            run(command, {rule: 'c->o'})
+            storeObject(job)
+            return true
+        }
+        remote.pending.push(job)
+        return true
+    }
+
+    /*
+        Split a compile command for a worker into the compiler name and flags. Workers supply the input and output
+        arguments themselves. Flags that only apply when linking are dropped. Returns null if the compiler or any
+        flag is not accepted by workers.
+     */
+    function workerJob(compile: String): Object? {
+        let args = compile.trim().split(/\s+/)
+        let compiler = Path(args.shift()).basename.toString()
+        let flags = []
+        for (let i = 0; i < args.length; i++) {
+            let arg = args[i]
+            if (arg == '-o' && args[i + 1] == 'job.o') {
+                i++
+            } else if (arg != '-c' && arg != 'job.i' && arg != '-pie' && !arg.startsWith('-Wl,')) {
+                flags.push(arg)
+            }
+        }
+        if (!MakeMe.WorkerCompilers.test(compiler) || !MakeMe.acceptWorkerFlags(flags)) {
+            return null
+        }
+        return { compiler: compiler, flags: flags }
+    }
+
+    /*
+        Wait for a remote compile job and write the object. The job is compiled locally if the worker fails or does
+        not confirm that it used the same compiler. Workers that reject jobs are not used again in this build.
+     */
+    function finishRemote(job) {
+        let http = job.http
+        let body = new ByteArray
+        let status, output, rejected
+        try {
+            if (http.status == Http.BadRequest) {
+                dropWorker(job.worker, http.response)
+                rejected = true
+
+            } else if (http.status == Http.Ok && http.header('X-MakeMe-Identity') == remote.identity) {
+                let buf = new ByteArray
+                while (http.read(buf) > 0) {
+                    body.write(buf)
+                    buf.flush()
+                }
+                status = http.header('X-MakeMe-Status')
+                output = body.readString(http.header('X-MakeMe-Output') cast Number)
+            }
+        } catch {}
+        http.close()
+        if (status == null) {
+            if (!rejected) {
+                trace('Warn', 'Compile job for ' + job.path.natural.relative + ' failed on worker ' + job.worker +
+                    ', compiling locally')
+            }
+            run(job.command, {rule: 'c->o'})
+            storeObject(job)
+            return
+        }
+        if (output) {
+            prints(output)
+        }
+        if (status != 0) {
+            let msg = 'Building target ' + job.target.name + '\nCommand failure on worker ' + job.worker +
+                '\nCommand: ' + job.command
+            if (options['continue']) {
+                trace('Error', msg)
+                return
+            }
+            throw msg
+        }
+        let file = new File(job.path, 'w')
+        file.write(body)
+        file.close()
+        storeObject(job)
+    }
+
+    /*
+        Stop sending jobs to a worker that rejected a job, such as a worker with a different compiler
+     */
+    function dropWorker(worker: String, reason: String?) {
+        if (remote.workers && remote.workers.contains(worker)) {
+            trace('Warn', 'Worker ' + worker + ' rejected a compile job: ' + (reason || '').trim())
+            remote.workers = remote.workers.filter(function(w) w != worker)
+            if (remote.workers.length == 0) {
+                remote.workers = null
+            }
+        }
+    }
+
+    /*
+        Abandon remote compile jobs that are still pending
+     */
+    function closeRemote() {
+        for each (job in remote.pending) {
+            job.http.close()
+        }
+        remote.pending = []
+    }
+
+    /*
+        Wait for all pending remote compile jobs
+     */
+    function waitRemote() {
+        while (remote && remote.pending.length > 0) {
+            finishRemote(remote.pending.shift())
+        }
+    }
+
+    /*
+        Object cache settings for the build. The local cache directory defaults to ~/.makeme/objects. The optional
+        remote tier is an HTTP endpoint that stores objects by key, such as the /cache endpoint of "me --worker".
+        Returns null if caching is not enabled.
+     */
+    function cacheSettings(): Object? {
+        let settings = me.settings.cache
+        if (!settings && !options.cache) {
+            return null
+        }
+        let cache = blend({ upload: true }, (settings is Boolean || !settings) ? {} : settings)
+        if (options.cache) {
+            cache.url = options.cache
+        }
+        cache.dir = Path(cache.dir || MakeMe.ObjectCache)
+        if (cache.url) {
+            cache.url = cache.url.toString().trimEnd('/')
+        }
+        return cache
+    }
+
+    /*
+        Copy the object for a job from the local or remote cache. Objects fetched from the remote cache are also
+        saved in the local cache. Returns true if the object was found.
+     */
+    function fetchObject(job): Boolean {
+        let cache = remote.cache
+        let local = cache.dir.join(job.key.slice(0, 2), job.key + '.o')
+        if (local.exists) {
+            local.copy(job.path)
+            vtrace('Cached', job.path.natural.relative)
+            return true
+        }
+        if (!cache.url) {
+            return false
+        }
+        let http = new Http
+        try {
+            http.get(cache.url + '/' + job.key)
+            if (http.status != Http.Ok) {
+                http.close()
+                return false
+            }
+            let file = new File(job.path, 'w')
+            let buf = new ByteArray
+            while (http.read(buf) > 0) {
+                file.write(buf)
+                buf.flush()
+            }
+            file.close()
+        } catch (e) {
+            trace('Warn', 'Cannot use the object cache at ' + cache.url + ', ' + e.message)
+            delete cache.url
+            http.close()
+            return false
+        }
+        http.close()
+        vtrace('Cached', job.path.natural.relative + ' from ' + cache.url)
+        storeObject(job, false)
+        return true
+    }
+
+    /*
+        Save the object for a job in the local cache and upload it to the remote cache
+     */
+    function storeObject(job, upload: Boolean = true) {
+        let cache = remote.cache
+        if (!cache || !job.path.exists) {
+            return
+        }
+        let local = cache.dir.join(job.key.slice(0, 2), job.key + '.o')
+        let tmp = local.dirname.join('tmp-' + App.pid + '-' + local.basename)
+        try {
+            local.dirname.makeDir()
+            job.path.copy(tmp)
+            tmp.rename(local)
+        } catch (e) {
+            tmp.remove()
+            vtrace('Warn', 'Cannot save ' + job.path + ' in the object cache: ' + e.message)
+        }
+        if (upload && cache.url && cache.upload) {
+            let http = new Http
+            try {
+                let token = App.getenv(MakeMe.CacheToken)
+                http.setHeader('Content-Type', 'application/octet-stream')
+                if (token) {
+                    http.setHeader('X-MakeMe-Token', token)
+                }
+                http.put(cache.url + '/' + job.key, job.path.readBytes())
+                if (http.status == Http.Forbidden) {
+                    trace('Warn', 'The object cache at ' + cache.url + ' does not accept uploads. Set ' +
+                        MakeMe.CacheToken + ' to the token of the cache.')
+                    cache.upload = false
+                } else if (http.status != Http.Ok && http.status != Http.Created && http.status != Http.NoContent) {
+                    vtrace('Warn', 'Cannot upload ' + job.path + ' to the object cache, status ' + http.status)
+                }
+            } catch (e) {
+                trace('Warn', 'Cannot upload to the object cache at ' + cache.url + ', ' + e.message)
+                delete cache.url
+            }
+            http.close()
+        }
+    }
+
     function buildResource(target) {
         let ext = target.path.extension
         for each (file in target.files) {
@@ -275,7 +595,7 @@ public class Builder {
             }
             let command = expandRule(target, rule)
             trace('Compile', target.path.relative)
-            run(command)
+            run(command, {rule: transition})
         }
     }
 
@@ -307,11 +627,12 @@ public class Builder {
         } else {
             safeRemove(target.path)
         }
-        run(command, {filter: /Creating library /})
+        run(command, {filter: /Creating library /, rule: transition})
     }
 
     function buildStaticLib(target) {
-        let transition = target.rule || 'lib'
+        let thin = (target.thin != null) ? target.thin : me.settings.thin
+        let transition = target.rule || ((thin && me.rules['lib-thin']) ? 'lib-thin' : 'lib')
         let rule = me.rules[transition]
         if (!rule) {
             throw 'No rule to build target ' + target.path + ' for transition ' + transition
@@ -324,10 +645,53 @@ public class Builder {
             trace('Preserve', 'Active target ' + target.path.relative + ' as ' + active)
             active.remove()
             try { target.path.rename(target.path.replaceExt('old')) } catch {}
+        } else if (transition == 'lib' && updateStaticLib(target)) {
+            return
         } else {
             safeRemove(target.path)
         }
-        run(command, {filter: /has no symbols|Creating library /})
+        run(command, {filter: /has no symbols|Creating library /, rule: transition})
+    }
+
+    /*
+        Update an existing static library by replacing only the members for objects modified since the library
+        was created and adding new objects. The library must be rebuilt if it has members that are no longer
+        required or if objects share the same name. Thin archives are always rebuilt as they only reference
+        the objects. Returns true if the library was updated.
+     */
+    function updateStaticLib(target): Boolean {
+        let rule = me.rules['lib-update']
+        let modified = target.path.modified
+        if (!rule || !modified) {
+            return false
+        }
+        let names = {}
+        for each (file in target.files) {
+            let name = file.basename
+            if (names[name]) {
+                return false
+            }
+            names[name] = file
+        }
+        let listing = run([me.targets.lib.path, '-t', target.path], {filter: true, noshow: true})
+        let members = {}
+        for each (name in listing.trim().split(/\r?\n/)) {
+            if (!names[name]) {
+                return false
+            }
+            members[name] = true
+        }
+        /* Modification times have one second resolution, so objects from the same second are also replaced */
+        let files = target.files.filter(function(file: Path) !members[file.basename] || file.modified >= modified)
+        if (files.length == 0) {
+            return false
+        }
+        let vars = blend({}, target.vars)
+        vars.INPUT = files.map(function(p) '"' + p.compact().portable + '"').join(' ')
+        vtrace('Update', target.path.natural.relative + ' with ' + files.length + ' of ' + target.files.length +
+            ' objects')
+        run(loader.expand(rule).expand(vars, {missing: ''}), {filter: /has no symbols/, rule: 'lib-update'})
+        return true
     }
 
     /*
@@ -440,7 +804,7 @@ public class Builder {
                     let header = me.dir.inc.join(file.basename)
                     loader.createTarget({ name: header, enable: true, path: header, type: 'header', home: target.home,
                         goals: [target.name], files: [ file ], includes: target.includes, generate: true,
-                        belongs: target.name })
+                        belongs: target.name, hardlink: target.hardlink })
                     target.depends.push(header)
                 }
                 if (target.type == 'header') {
@@ -520,6 +884,26 @@ public class Builder {
         return null
     }
 
+    /*
+        Get the dependencies of a target in depends + uses order. Each item has the dependency name, the target found
+        by getDep or null, whether the target has exactly that name and whether it came from uses. Lists are built on
+        first use and discarded when dependencies are resolved and again after wildcards add object dependencies.
+     */
+    function getDeps(target): Array {
+        let list = depTargets[target.name]
+        if (!list) {
+            list = []
+            let count = target.depends.length
+            for each (dname in (target.depends + target.uses)) {
+                let dep = getDep(dname)
+                list.push({ name: dname, target: dep, exact: dep != null && me.targets[dname] === dep,
+                    uses: list.length >= count })
+            }
+            depTargets[target.name] = list
+        }
+        return list
+    }
+
     function makeDirs() {
         for (let [name, dir] in me.dir) {
             if (dir.startsWith(me.dir.bld)) {
@@ -709,6 +1093,7 @@ public class Builder {
         enableTargets()
         resolveDependencies()
         expandWildcards()
+        depTargets = {}
 
         Object.sortProperties(me.targets)
         Object.sortProperties(me)
@@ -764,6 +1149,207 @@ public class Builder {
         }
     }
 
+    /**
+        Build with profile guided optimization. The goals are first built with instrumented binaries which are
+        exercised by running the training goals defined by settings.pgo.train. The goals are then rebuilt using
+        the recorded profile data. Profile data is saved in settings.pgo.dir which defaults to build/PLATFORM/pgo.
+        Requires GCC or Clang.
+        @hide
+     */
+    public function pgo(start: Path, goals = []) {
+        if (!start.exists) {
+            throw 'Cannot find ' + start
+        }
+        if (!(goals is Array)) {
+            goals = [goals]
+        }
+        let files = loader.getPlatformFiles(start)
+        if (files.length > 1) {
+            throw 'Cannot use profile guided optimization for multiple platforms'
+        }
+        Me()
+        loader.loadFile(files[0])
+        if (me.platform.like != 'unix') {
+            throw 'Profile guided optimization requires GCC or Clang'
+        }
+        let settings = me.settings.pgo || {}
+        let train = settings.train
+        if (!train) {
+            throw 'Define the training goals to run in settings.pgo.train'
+        }
+        prepBuild()
+        let dir = Path(settings.dir || me.dir.out.join('pgo')).absolute
+        let clang = me.targets.compiler.path.basename.contains('clang')
+        let rebuild = options.rebuild
+        try {
+            trace('Profile', 'Build instrumented binaries')
+            dir.removeAll()
+            dir.makeDir()
+            setProfileFlags(['-fprofile-generate=' + dir])
+            options.rebuild = true
+            build(goals.clone())
+            options.rebuild = rebuild
+
+            trace('Profile', 'Run training goals: ' + train)
+            build((train is Array) ? train.clone() : [train])
+
+            trace('Profile', 'Rebuild with profile data')
+            if (clang) {
+                setProfileFlags(['-fprofile-use=' + mergeProfiles(dir), '-Wno-profile-instr-unprofiled',
+                    '-Wno-profile-instr-out-of-date'])
+            } else {
+                setProfileFlags(['-fprofile-use=' + dir, '-fprofile-correction', '-Wno-missing-profile'])
+            }
+            options.rebuild = true
+            build(goals)
+        } catch (e) {
+            removeProfileObjects()
+            throw e
+        } finally {
+            options.rebuild = rebuild
+        }
+        trace('Complete', goals)
+    }
+
+    /*
+        Remove objects built with profile flags so an interrupted profile build is not later seen as up to date
+     */
+    function removeProfileObjects() {
+        for each (target in me.targets) {
+            if (target.type == 'obj' && target.enable) {
+                target.path.remove()
+            }
+        }
+    }
+
+    /**
+        Report the most expensive commands from the command log of each configured platform.
+        All commands of the most recent build of each target are summed, so the report reflects the current tree.
+        @param start Start MakeMe file
+        @param count Number of compile commands to list
+     */
+    public function stats(start: Path, count: Number = 20) {
+        if (!start.exists) {
+            throw 'Cannot find ' + start
+        }
+        for each (file in loader.getPlatformFiles(start)) {
+            Me()
+            loader.loadFile(file)
+            let path = me.dir.out.join(CommandLog)
+            if (!path.exists) {
+                trace('Stats', 'No commands logged for ' + me.platform.name + '. Run "me" first.')
+                continue
+            }
+            /*
+                Sum every command of each target from the most recent build of that target. Compiles are ranked
+                using only the compile transitions, not the preprocessing that precedes remote or cached compiles.
+             */
+            let targets = {}, others = [], last = 0
+            for each (line in path.readLines()) {
+                if (!line) {
+                    continue
+                }
+                let record = deserialize(line)
+                record.build ||= 0
+                record.elapsed = record.end - record.start
+                last = Math.max(last, record.build)
+                if (!record.target) {
+                    others.push(record)
+                    continue
+                }
+                let sum = targets[record.target]
+                if (!sum || record.build > sum.build) {
+                    sum = targets[record.target] = { target: record.target, build: record.build,
+                        elapsed: 0, user: 0, sys: 0, rss: null, commands: 0, compiles: 0, compile: 0 }
+                } else if (record.build < sum.build) {
+                    continue
+                }
+                sum.elapsed += record.elapsed
+                sum.user += record.user || 0
+                sum.sys += record.sys || 0
+                if (record.rss != null) {
+                    sum.rss = Math.max(sum.rss || 0, record.rss)
+                }
+                sum.commands++
+                if (record.rule && record.rule.endsWith('->o')) {
+                    sum.compiles++
+                    sum.compile += record.elapsed
+                }
+            }
+            let totals = { elapsed: 0, user: 0, sys: 0, commands: 0 }
+            for each (record in others) {
+                if (record.build == last) {
+                    totals.elapsed += record.elapsed
+                    totals.user += record.user || 0
+                    totals.sys += record.sys || 0
+                    totals.commands++
+                }
+            }
+            let compiles = []
+            for each (sum in targets) {
+                totals.elapsed += sum.elapsed
+                totals.user += sum.user
+                totals.sys += sum.sys
+                totals.commands += sum.commands
+                if (sum.compiles > 0) {
+                    compiles.push(sum)
+                }
+            }
+            compiles.sort(function(list, i, j) list[j].compile - list[i].compile)
+            trace('Stats', me.platform.name + ': ' + totals.commands + ' commands, ' + compiles.length + ' compiles')
+            trace('Total', 'Elapsed %.2f' % (totals.elapsed / 1000) + ' secs, user %.2f' % (totals.user / 1000) +
+                ' secs, system %.2f' % (totals.sys / 1000) + ' secs')
+            print('\n    %-40s %9s %9s %9s %9s'.format(['Target', 'Elapsed', 'User', 'System', 'Max RSS']))
+            for each (record in compiles.slice(0, count)) {
+                let rss = (record.rss != null) ? ('%.1f' % (record.rss / (1024 * 1024)) + ' MB') : '-'
+                print('    %-40s %9s %9s %9s %9s'.format([Path(record.target).relativeTo(me.dir.top),
+                    '%.2f' % (record.elapsed / 1000), '%.2f' % (record.user / 1000),
+                    '%.2f' % (record.sys / 1000), rss]))
+            }
+            print()
+        }
+    }
+
+    /*
+        Merge the raw Clang profiles from the training goals. Returns the merged profile data path.
+     */
+    function mergeProfiles(dir: Path): Path {
+        let profdata = dir.join('default.profdata')
+        let tool
+        if (me.platform.os == 'macosx') {
+            tool = ['xcrun', 'llvm-profdata']
+        } else {
+            tool = [Cmd.locate('llvm-profdata')]
+            if (!tool[0]) {
+                throw 'Cannot find llvm-profdata to merge profile data'
+            }
+        }
+        let raw = dir.files('*.profraw')
+        if (raw.length == 0) {
+            throw 'The training goals did not create any profile data in ' + dir
+        }
+        run(tool.concat(['merge', '-output=' + profdata]).concat(raw))
+        return profdata
+    }
+
+    /*
+        Replace the profile flags of enabled object, executable and shared library targets
+     */
+    function setProfileFlags(flags: Array) {
+        let strip = function(list) (list || []).filter(function(flag)
+            !flag.toString().match(/^-fprofile-|^-Wno-(missing-profile|profile-instr)/))
+        for each (target in me.targets) {
+            if (!target.enable) {
+                continue
+            }
+            if (target.type == 'obj') {
+                target.compiler = strip(target.compiler).concat(flags)
+            } else if (target.type == 'exe' || (target.type == 'lib' && !target.static)) {
+                target.linker = strip(target.linker).concat(flags)
+            }
+        }
+    }
+
     /**
         Process a top level MakeMe file
         @hide
@@ -805,15 +1391,22 @@ public class Builder {
     }
 
     /*
-        Resolve a target by inheriting dependent libraries from dependent targets
+        Resolve a target by inheriting dependent libraries from dependent targets.
+        Libraries are merged via a hashed copy of the target libraries. Libraries that go first are collected per
+        dependency and the result is assembled once, so each dependency only costs the size of its own libraries.
      */
     function resolve(target) {
         if (!admit(target, 'resolve')) {
             return
         }
         runTargetScript(target, 'preresolve')
-        for each (dname in (target.depends + target.uses)) {
-            let dep = getDep(dname)
+        let libraries = []
+        if (target.libraries) {
+            libraries.appendUnique(target.libraries)
+        }
+        let first = [], last = [], reorder = false
+        for each (item in getDeps(target)) {
+            let dep = item.target
             if (dep) {
                 /*
                     If generating for make|nmake still inherit dependencies as these are conditional build files
@@ -846,24 +1439,49 @@ public class Builder {
                             lpath = libname
                         }
                     }
-                    target.libraries ||= []
-                    if (!target.libraries.contains(lpath)) {
-                        target.libraries = [lpath] + target.libraries
+                    let count = libraries.length
+                    if (libraries.appendUnique([lpath]).length > count) {
+                        first.push([lpath])
                     }
                 } else if (dep.configurable) {
                     if (dep.libraries) {
-                        target.libraries ||= []
-                        target.libraries = (dep.libraries + target.libraries).unique()
+                        /* Configurable libraries go first and move existing duplicates forward */
+                        libraries.appendUnique(dep.libraries)
+                        first.push(dep.libraries)
+                        reorder = true
+                    }
+                }
+                if (dep.libraries) {
+                    let count = libraries.length
+                    libraries.appendUnique(dep.libraries)
+                    for (let i = count; i < libraries.length; i++) {
+                        last.push(libraries[i])
                     }
                 }
-                loader.inheritCompSettings(target, dep)
+                loader.inheritCompOptions(target, dep)
             }
         }
+        if (first.length > 0 || last.length > 0) {
+            let result = []
+            for (let i = first.length - 1; i >= 0; i--) {
+                for each (lib in first[i]) {
+                    result.push(lib)
+                }
+            }
+            for each (lib in target.libraries) {
+                result.push(lib)
+            }
+            for each (lib in last) {
+                result.push(lib)
+            }
+            target.libraries = reorder ? result.unique() : result
+        }
         runTargetScript(target, 'postresolve')
     }
 
     function resolveDependencies() {
         admitSetup('resolve')
+        depTargets = {}
         for each (target in me.targets) {
             if (target.enable) {
                 resolve(target)
@@ -871,6 +1489,47 @@ public class Builder {
         }
     }
 
+    /*
+        Append a record of a completed command to the command log. Records are JSON lines with the time this build
+        started, the command start and end times, the user and system CPU time in milliseconds, the maximum resident
+        set size, the build rule and the current target.
+     */
+    function logCommand(command, cmd: Cmd, started: Number, rule: String?) {
+        if (!me.dir || !me.dir.out || !me.dir.out.exists) {
+            return
+        }
+        let path = me.dir.out.join(CommandLog)
+        if (!commandLogs[path]) {
+            commandLogs[path] = true
+            if (path.exists && path.size > CommandLogLimit) {
+                path.remove()
+            }
+        }
+        let usage = cmd.usage || {}
+        let record = {
+            build: buildStarted,
+            start: started,
+            end: Date.now(),
+            user: usage.user,
+            sys: usage.sys,
+            rss: usage.rss,
+            status: cmd.status,
+        }
+        if (rule) {
+            record.rule = rule
+        }
+        if (me.target) {
+            record.target = me.target.name
+            record.type = me.target.type
+        }
+        if (command is Array) {
+            record.command = command.join(' ')
+        } else {
+            record.command = command
+        }
+        path.append(serialize(record) + '\n')
+    }
+
     /**
         Run a command and trace output if copt.show or options.show
         @param command Command to run. May be an array of args or a string.
@@ -882,6 +1541,7 @@ public class Builder {
         @option generate Generate in projects. Defaults to true.
         @option noshow Do not show the command line before executing. Useful to override me --show for one command.
         @option nostop Continue processing even if this command is not successful.
+        @option rule Build rule or transition of the command, such as 'c->o'. This is recorded in the command log.
         @option show Show the command line before executing. Similar to me --show, but operates on just this command.
         @option timeout Timeout for the command to complete
 
@@ -940,12 +1600,14 @@ public class Builder {
         if (data) {
             copt = blend({detach: true}, copt)
         }
+        let started = Date.now()
         cmd.start(command, copt)
         if (data) {
             let written = cmd.write(data)
             cmd.finalize()
         }
         cmd.wait()
+        logCommand(command, cmd, started, copt.rule)
         let response = results.toString()
 
         if (cmd.status != 0) {
@@ -1056,34 +1718,39 @@ public class Builder {
         }
         if (goal === true || target.goals.contains(goal)) {
             target.selected = true
-            for each (dname in target.depends) {
+            let deps = getDeps(target)
+            for each (item in deps) {
+                if (item.uses) {
+                    continue
+                }
+                let dname = item.name
                 if (dname == Builder.ALL) {
                     for each (target in me.targets) {
                         selectDependentTargets(target, dname)
                     }
                 } else {
-                    let dep = me.targets[dname]
+                    let dep = item.exact ? item.target : null
                     if (dep) {
                         if (!dep.selected) {
                             selectDependentTargets(dep, true)
                         }
-                    } else if (!Path(dname).exists && !me.targets[dname]) {
+                    } else if (!Path(dname).exists) {
                         throw 'Unknown dependency "' + dname + '" in target "' + target.name + '"'
                     }
                 }
             }
-            for each (dname in target.uses) {
-                let dep = me.targets[dname]
-                if (dep && !dep.selected) {
+            for each (item in deps) {
+                let dep = item.exact ? item.target : null
+                if (item.uses && dep && !dep.selected) {
                     selectDependentTargets(dep, true)
                 }
             }
             /*
                 Select targets used by this target if they are enabled. No error if not enabled.
              */
-            for each (dname in target.uses) {
-                let dep = me.targets[dname]
-                if (dep && dep.enable && !dep.selected) {
+            for each (item in deps) {
+                let dep = item.exact ? item.target : null
+                if (item.uses && dep && dep.enable && !dep.selected) {
                     selectDependentTargets(dep, true)
                 }
             }
@@ -1290,9 +1957,10 @@ public class Builder {
                 }
             }
         }
-        for each (let dname: Path in (target.depends + target.uses)) {
+        for each (item in getDeps(target)) {
             let file
-            let dep = getDep(dname)
+            let dname = Path(item.name)
+            let dep = item.target
             if (!dep) {
                 /* Dependency not found as a target , so treat as a file */
                 if (!dname.modified) {
@@ -1312,8 +1980,9 @@ public class Builder {
                 if (!dep.enable) {
                     continue
                 }
-                for each (let sname: Path in (dep.depends + dep.uses)) {
-                    let sub = getDep(sname)
+                for each (subitem in getDeps(dep)) {
+                    let sname = subitem.name
+                    let sub = subitem.target
                     if (sub && sub.enable && sub.name != target.name) {
                         if (stale(sub)) {
                             whyRebuild(name, 'Rebuild', 'dependent target ' + sname + ' is stale, for "' + dname + '"')
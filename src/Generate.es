@@ -8,6 +8,7 @@ module embedthis.me {
 class Generate {
 
     public var mappings: Object = {}
+    public var substitutions: Object = {}
     public var generator: Object
 
     var builder: Builder
@@ -31,6 +32,8 @@ class Generate {
         let platforms = Object.getOwnPropertyNames(options.platforms)
         if (platforms.length == 0) {
             generateProjects()
+        } else if (platforms.length > 1 && Path(options.file).absolute.dirname.same(App.dir)) {
+            generatePlatforms(platforms)
         } else {
             for each (platform in platforms) {
                 Me()
@@ -47,6 +50,79 @@ class Generate {
         makeme.generating = null
     }
 
+    /*
+        Generate projects for multiple platforms concurrently. Each platform needs its own loaded and prepared DOM,
+        so each is generated by a child "me" which generates all requested formats from one prepared target graph.
+        The children skip loading the current configuration as that has already been done here.
+        Output is emitted per-platform as each child completes.
+     */
+    function generatePlatforms(platforms: Array) {
+        let children = []
+        for each (platform in platforms) {
+            let args = platformArgs(platform)
+            strace('Run', args.join(' '))
+            let cmd = new Cmd
+            cmd.start(args, {detach: true, dir: App.dir})
+            cmd.finalize()
+            children.push({platform: platform, cmd: cmd})
+        }
+        let failed = []
+        for each (child in children) {
+            let cmd = child.cmd
+            cmd.wait()
+            let response = cmd.response
+            if (response) {
+                prints(response)
+            }
+            if (cmd.error) {
+                App.errorStream.write(cmd.error)
+            }
+            if (cmd.status != 0) {
+                failed.push(child.platform)
+            }
+        }
+        if (failed.length > 0) {
+            throw 'Cannot generate projects for ' + failed.join(', ')
+        }
+    }
+
+    /*
+        Command line to generate projects for one platform. Per-platform --with, --without, --set and --unset
+        options are passed through.
+     */
+    function platformArgs(platform: String): Array {
+        let args = [App.exePath, '--file', Path(options.file).absolute, '--gen', options.gen.join(','), 
+            '--genonly', '--platform', platform]
+        for each (name in ['debug', 'diagnose', 'force', 'keep', 'overwrite', 'quiet', 'release', 'show', 'verbose', 
+                'why']) {
+            if (options[name]) {
+                args.push('--' + name)
+            }
+        }
+        for each (name in ['name', 'prefixes', 'profile']) {
+            if (options[name]) {
+                args.push('--' + name, options[name])
+            }
+        }
+        for each (prefix in options.prefix) {
+            args.push('--prefix', prefix)
+        }
+        let poptions = options.platforms[platform]
+        for each (item in poptions['with']) {
+            args.push('--with', item)
+        }
+        for each (item in poptions.without) {
+            args.push('--without', item)
+        }
+        for each (item in poptions.enable) {
+            args.push('--set', item)
+        }
+        for each (item in poptions.disable) {
+            args.push('--unset', item)
+        }
+        return args
+    }
+
     function generateProjects() {
         me.settings.name ||= 'app'
         let base = me.dir.proj.join(me.settings.name + '-' + me.platform.os + '-' + me.platform.profile)
@@ -106,6 +182,7 @@ class Generate {
             lbin:           me.globals.LBIN ? me.globals.LBIN.relative : me.globals.BIN,
         }
         blend(mappings, me.prefixes)
+        substitutions = {}
     }
 
     public function main() {
@@ -22,10 +22,16 @@ public class Loader {
     public static const Unix = ['macosx', 'linux', 'unix', 'freebsd', 'solaris']
     public static const Windows = ['windows', 'wince']
 
+    /** Cached MakeMe modules not modified for this many milliseconds are removed */
+    static const ScriptCacheAge = 30 * 24 * 60 * 60 * 1000
+
+    /** MakeMe files loaded and their modification times. Used by the build daemon to detect changes */
+    public var inputs: Object = {}
     public var localPlatform: String
     private static var loadObj
     private var loaded: Object
     private var options: Object
+    private var pruned: Boolean
 
     function Loader() {
         options = makeme.options
@@ -253,7 +259,7 @@ public class Loader {
                     vtrace('Module', path)
                     try {
                         makeItemGlobals(path.dirname)
-                        global.load(path)
+                        loadScript(path)
                     } catch (e) {
                         throw new Error('When loading: ' + path + '\n' + e)
                     }
@@ -478,25 +484,42 @@ public class Loader {
 
     /*
         Expand tokens in all fields in an object hash. This is used to expand tokens in me file objects.
+        Only strings and paths containing "$" are expanded. Walking values in script is slower than serializing them,
+        so the top two levels (the sections of "me" and the objects in them, such as targets) are skipped if their
+        serialization has no "$". Deeper objects are walked and only their leaf values are tested, so no value is
+        serialized more than twice. Fully expanded results are memoized as the same token strings recur across targets.
      */
-    function expandTokens(o) {
-        let x
-        if (me.targets.removeFiles) {
-            if (me.targets.removeFiles.enable is String) x = 1
-        }
-        for (let [key,value] in o) {
+    function expandTokens(o, expanded = {}, depth = 0) {
+        for (let key in o) {
+            let value = o[key]
             if (value is String) {
-                let newValue
-                o[key] = newValue = expand(value)
+                if (value.contains('$')) {
+                    o[key] = expandToken(value, expanded)
+                }
             } else if (value is Path) {
-                o[key] = Path(expand(value))
-            } else if (Object.getOwnPropertyCount(value) > 0) {
-                o[key] = expandTokens(value)
+                if (value.name.contains('$')) {
+                    o[key] = Path(expandToken(value.name, expanded))
+                }
+            } else if (value && !(value is Boolean) && Object.getOwnPropertyCount(value) > 0) {
+                if (depth >= 2 || serialize(value).contains('$')) {
+                    expandTokens(value, expanded, depth + 1)
+                }
             }
         }
         return o
     }
 
+    private function expandToken(str: String, expanded): String {
+        let result = expanded[str]
+        if (result == undefined) {
+            result = expand(str)
+            if (!result.contains('${')) {
+                expanded[str] = result
+            }
+        }
+        return result
+    }
+
     /*
         Fix legacy properties and prepend combine prefixes to properties that must be aggregated
      */
@@ -696,7 +719,7 @@ public class Loader {
     public function getPlatformFiles(path): Array {
         let files = []
         if (path.exists) {
-            global.load(expand(path, {missing: '.'}))
+            loadScript(expand(path, {missing: '.'}))
             checkVersion(path, loadObj);
             platforms = loadObj.platforms
             if (platforms) {
@@ -740,6 +763,18 @@ public class Loader {
         if (!dep) {
             return
         }
+        inheritCompOptions(target, dep, inheritCompiler)
+        if (dep.libraries && dep.libraries.length > 0) {
+            /* Libraries may be shared with other targets so modify a copy */
+            target.libraries = target.libraries.clone(false).appendUnique(dep.libraries)
+        }
+    }
+
+    /*
+        Inherit compilation properties other than libraries from a dependent target. Builder.resolve() merges the
+        libraries of all dependencies itself.
+     */
+    public function inheritCompOptions(target, dep, inheritCompiler = false) {
         target.defines ||= []
         target.compiler ||= []
         target.includes ||= []
@@ -747,36 +782,12 @@ public class Loader {
         target.libraries ||= []
         target.linker ||= []
 
-        if (inheritCompiler) {
-            for each (option in dep.compiler) {
-                if (!target.compiler.contains(option)) {
-                    target.compiler.push(option)
-                }
-            }
+        if (inheritCompiler && dep.compiler) {
+            target.compiler.appendUnique(dep.compiler)
         }
-        for each (option in dep.defines) {
-            if (!target.defines.contains(option)) {
-                target.defines.push(option)
-            }
-        }
-        for each (option in dep.includes) {
-            if (!target.includes.contains(option)) {
-                target.includes.push(option)
-            }
-        }
-        for each (option in dep.libpaths) {
-            if (!target.libpaths.contains(option)) {
-                target.libpaths.push(option)
-            }
-        }
-        for each (lib in dep.libraries) {
-            if (!target.libraries.contains(lib)) {
-                target.libraries = target.libraries + [lib]
-            }
-        }
-        for each (option in dep.linker) {
-            if (!target.linker.contains(option)) {
-                target.linker.push(option)
+        for each (field in ['defines', 'includes', 'libpaths', 'linker']) {
+            if (dep[field]) {
+                target[field].appendUnique(dep[field])
             }
         }
     }
@@ -924,6 +935,76 @@ public class Loader {
         }
     }
 
+    /**
+        Load and run a MakeMe file. The compiled module is cached under ~/.makeme/cache and reused by later runs.
+        The cache key is a digest of the file path and contents and of the MakeMe version and modules, so an edited file
+        or a new MakeMe compiler will always recompile. Modules older than thirty days are removed from the cache
+        when a new module is compiled.
+        @param path MakeMe file to load
+     */
+    public function loadScript(path: Path): Void {
+        inputs[path.absolute] = path.modified.time
+        let module = scriptModule(path)
+        if (module && module.exists) {
+            try {
+                global.load(module)
+                return
+            } catch (e) {
+                /* Another build may have pruned the module. Otherwise this is an error in the script */
+                if (module.exists) {
+                    throw e
+                }
+            }
+        }
+        if (!module) {
+            global.load(path)
+            return
+        }
+        pruneScriptCache(module.dirname)
+        /* Compile to a private name so concurrent builds never load a partial module */
+        let tmp = module.replaceExt('tmp-' + App.pid)
+        try {
+            global.load(path, {cache: tmp})
+            tmp.rename(module)
+        } finally {
+            tmp.remove()
+        }
+    }
+
+    /*
+        Remove cached modules that have not been recompiled recently. This runs once per build.
+     */
+    function pruneScriptCache(dir: Path) {
+        if (pruned) {
+            return
+        }
+        pruned = true
+        let expires = Date.now() - ScriptCacheAge
+        for each (file in dir.files('*')) {
+            let modified = file.modified
+            if (modified && modified.time < expires) {
+                file.remove()
+            }
+        }
+    }
+
+    /*
+        Return the cached module path for a MakeMe file or null if the cache cannot be used
+     */
+    function scriptModule(path: Path): Path? {
+        let dir = App.home.join('.makeme', 'cache')
+        if (!dir.exists && !dir.makeDir()) {
+            return null
+        }
+        let key = Config.Version
+        for each (mod in ['ejs.mod', 'me.mod']) {
+            let modified = App.exeDir.join(mod).modified
+            key += ' ' + (modified ? modified.time : '')
+        }
+        key += ' ' + path.absolute + '\n' + path.readString()
+        return dir.join(md5(key) + '.mod')
+    }
+
     public function makeDirectoryGlobals(base: Path? = null) {
         let tokens
         for each (n in ['BIN', 'BLD', 'OUT', 'INC', 'LIB', 'OBJ', 'PAKS', 'PKG', 'REL', 'SRC', 'TOP', 'LBIN']) {
@@ -1159,7 +1240,7 @@ public class Loader {
         let result
         try {
             vtrace('Load', path.compact())
-            global.load(path)
+            loadScript(path)
             result = loadObj
             result.origin = path.dirname
         }
@@ -6,7 +6,9 @@
  */
 module embedthis.me {
 
+require ejs.digest
 require ejs.unix
+require ejs.web
 require ejs.zlib
 require ejs.version
 
@@ -19,6 +21,34 @@ require ejs.version
 public class MakeMe {
     static const SupportedOS = ['freebsd', 'linux', 'macosx', 'solaris', 'vxworks', 'windows']
     static const SupportedArch = ['arm', 'i64', 'mips', 'ppc', 'sparc', 'x64', 'x86']
+
+    /* Options that a build daemon can honor per request. Other options change the loaded DOM */
+    static const DaemonOptions = ['benchmark', 'continue', 'force', 'keep', 'quiet', 'rebuild', 'show', 'verbose', 'why',
+        'cache', 'workers']
+    static const DaemonStatus = '\x1e'
+
+    /* Size of sun_path for Unix domain sockets including the trailing null */
+    static const DaemonPathMax = (Config.OS == 'macosx' || Config.OS == 'freebsd') ? 104 : 108
+
+    /** Compiler programs a worker will run. Workers locate the program on their own PATH */
+    public static const WorkerCompilers = /^([\w.]+-)?(cc|c\+\+|gcc|g\+\+|clang|clang\+\+)(-[\d.]+)?$/
+
+    /** Compiler flags a worker accepts. Flags that name files are not accepted */
+    public static const WorkerFlags =
+        /^(-O\w*|-g[\w-]*|-f[\w=.,+-]+|-m[\w=.,+-]+|-W[\w=.,+-]+|-std=[\w+]+|--param=[\w-]+=\w+|-ansi|-pedantic(-errors)?|-pipe|-w)$/
+
+    /** Compiler flags a worker refuses. These load code, write other files or pass options to other tools */
+    public static const WorkerDeniedFlags =
+        /^(-fplugin|-fdump|-fprofile|-fauto-profile|-fcompare-debug|-fcallgraph-info|-Wa,|-Wl,|-Wp,|-wrapper)/
+
+    /** Default local object cache directory. Also used by "me --worker" to serve the /cache endpoint */
+    public static const ObjectCache: Path = App.home.join('.makeme', 'objects')
+
+    /** Environment variable with the shared token required to upload objects to the /cache endpoint of a worker */
+    public static const CacheToken = 'MAKEME_CACHE_TOKEN'
+
+    /** Worker and client limits. Preprocessed sources are large and compiles may be idle for a long time */
+    public static const WorkerLimits = { receive: 1024 * 1024 * 1024, inactivityTimeout: 3600, requestTimeout: 3600 }
     
     /** Singleton $Builder reference */
     public var builder: Builder
@@ -48,17 +78,20 @@ public class MakeMe {
     public var status = 0
 
     private var out: Stream
+    private var identities: Object = {}
     private var args: Args
     private var goals: Array
 
     private var argTemplate = {
         options: {
             benchmark: { alias: 'b' },
+            cache: { range: String },
             /* Implemented in me.c */
             chdir: { range: String },
             configure: { range: String },
             configuration: { },
             'continue': { alias: 'c' },
+            daemon: { },
             debug: {},
             depth: { range: Number},
             deploy: { range: String },
@@ -68,6 +101,8 @@ public class MakeMe {
             file: { range: String },
             force: { alias: 'f' },
             gen: { range: String, separator: Array, commas: true },
+            /* Internal - generate projects without first loading and building the current configuration */
+            genonly: { },
             get: { range: String },
             help: { },
             import: { },
@@ -76,6 +111,7 @@ public class MakeMe {
             log: { alias: 'l', range: String },
             name: { range: String },
             overwrite: { },
+            pgo: { },
             out: { range: String },
             more: {alias: 'm'},
             nocross: {},
@@ -95,6 +131,7 @@ public class MakeMe {
             show: { alias: 's'},
             showPlatform: { },
             static: { },
+            stats: { },
             unicode: {},
             unset: { range: String, separator: Array },
             verbose: { alias: 'v' },
@@ -103,6 +140,8 @@ public class MakeMe {
             why: { alias: 'w' },
             'with': { range: String, separator: Array },
             without: { range: String, separator: Array },
+            worker: { range: String },
+            workers: { range: String, separator: Array, commas: true },
         },
         unknown: unknownArg,
         usage: usage
@@ -126,6 +165,10 @@ public class MakeMe {
             App.log.name = 'me'
             Me()
             parseArgs(args)
+            if (options.worker) {
+                worker()
+                return
+            }
             options.file = Path(options.file || findMakeMeFile() || Loader.START)
             if (!options.configure && options.gen != 'start') {
                 /* Must not change directory for init or out-of-tree source */
@@ -135,6 +178,13 @@ public class MakeMe {
                 import()
                 App.exit()
             }
+            if (options.daemon) {
+                daemon()
+                return
+            }
+            if (forward()) {
+                return
+            }
             if (options.gen == 'start' || options.gen == 'main') {
                 loader.initPlatform()
                 load(me.dir.me.join('Generate.es'))
@@ -158,7 +208,7 @@ public class MakeMe {
                 load(me.dir.me.join('Generate.es'))
                 makeme.generate = Generate()
                 let options = makeme.options
-                if (!configured) {
+                if (!configured && !options.genonly) {
                     /* Load current configuration */
                     builder.process(options.file)
                 }
@@ -171,6 +221,10 @@ public class MakeMe {
             }
             if (options.watch) {
                 builder.watch(options.file, goals)
+            } else if (options.pgo) {
+                builder.pgo(options.file, goals)
+            } else if (options.stats) {
+                builder.stats(options.file)
             } else {
                 builder.process(options.file, goals)
             }
@@ -221,6 +275,401 @@ public class MakeMe {
         return null
     }
 
+    /*
+        Path of the Unix domain socket for the build daemon of the current source tree
+     */
+    function daemonPath(): Path
+        options.file.dirname.join(Loader.BUILD, 'me.sock').absolute
+
+    /*
+        Run a resident build server for the current source tree. The server keeps the loaded and prepared DOM and
+        builds on request from "me" clients over a Unix domain socket. The DOM is reloaded when a MakeMe file or a
+        directory containing target files is modified.
+     */
+    function daemon() {
+        if (Config.OS == 'windows') {
+            throw 'The build daemon requires Unix domain sockets'
+        }
+        let path = daemonPath()
+        if (path.toString().length >= DaemonPathMax) {
+            throw 'The build daemon socket path ' + path + ' is too long. Unix domain socket paths must be less than ' +
+                DaemonPathMax + ' bytes. Run the daemon from a tree with a shorter path'
+        }
+        if (path.exists) {
+            let sock = new Socket
+            try {
+                sock.connect(path)
+                sock.close()
+                throw 'A build daemon is already running for this tree at ' + path
+            } catch (e) {
+                if (e is String) {
+                    throw e
+                }
+            }
+            path.remove()
+        }
+        let files = loader.getPlatformFiles(options.file)
+        if (files.length > 1) {
+            throw 'Cannot run a build daemon for multiple platforms'
+        }
+        let top = App.dir
+        let inputs = loadDaemon(files[0])
+        let server = new Socket
+        path.dirname.makeDir()
+        server.listen(path)
+        trace('Daemon', 'Listening at ' + path)
+        try {
+            while (true) {
+                let client = server.accept()
+                if (!client) {
+                    continue
+                }
+                App.chdir(top)
+                serveDaemon(client, function() {
+                    if (daemonStale(inputs)) {
+                        trace('Reload', files[0])
+                        inputs = loadDaemon(files[0])
+                    }
+                })
+                App.chdir(top)
+            }
+        } finally {
+            server.close()
+            path.remove()
+        }
+    }
+
+    /*
+        Test if any input recorded by loadDaemon has been modified
+     */
+    function daemonStale(inputs): Boolean {
+        for (let [path, modified] in inputs) {
+            let when = Path(path).modified
+            if (!when || when.time != modified) {
+                return true
+            }
+        }
+        return false
+    }
+
+    /*
+        Forward the requested build to a daemon for this source tree if one is running. Only plain builds are forwarded.
+        Returns true if the daemon ran the build.
+     */
+    function forward(): Boolean {
+        if (Config.OS == 'windows') {
+            return false
+        }
+        let path = daemonPath()
+        if (!path.exists) {
+            return false
+        }
+        for (let [key, value] in options) {
+            if (value && !DaemonOptions.contains(key) && key != 'file' && key != 'platforms') {
+                return false
+            }
+        }
+        if (Object.getOwnPropertyCount(options.platforms) > 0 ||
+                goals.some(function(goal) ['configure', 'dump', 'generate', 'import', 'init'].contains(goal))) {
+            return false
+        }
+        let sock = new Socket
+        try {
+            sock.connect(path)
+        } catch {
+            vtrace('Daemon', 'Cannot connect to ' + path)
+            return false
+        }
+        let request = { goals: goals, options: {} }
+        for each (key in DaemonOptions) {
+            request.options[key] = options[key]
+        }
+        sock.write(serialize(request) + '\n')
+
+        let buf = new ByteArray
+        let text = ''
+        while (sock.read(buf) > 0) {
+            text += buf.readString()
+            let end = text.lastIndexOf('\n')
+            if (end >= 0) {
+                text = daemonOutput(text.slice(0, end + 1)) + text.slice(end + 1)
+            }
+        }
+        sock.close()
+        daemonOutput(text)
+        if (status) {
+            App.exit(status)
+        }
+        return true
+    }
+
+    /*
+        Emit lines of daemon output and extract the final status line
+     */
+    private function daemonOutput(text: String): String {
+        for each (line in text.split('\n')) {
+            if (line.startsWith(DaemonStatus)) {
+                status = line.slice(1) cast Number
+            } else if (line) {
+                out.write(line + '\n')
+            }
+        }
+        return ''
+    }
+
+    /*
+        Load and prepare the DOM for the daemon. Returns the modification times of the inputs to watch.
+     */
+    private function loadDaemon(path: Path): Object {
+        Me()
+        loader.reset()
+        loader.inputs = {}
+        loader.loadFile(path)
+        builder.prepBuild()
+        let inputs = loader.inputs
+        for each (target in me.targets) {
+            if (target.enable) {
+                for each (file in target.files) {
+                    let dir = Path(file).dirname
+                    inputs[dir] ||= dir.modified ? dir.modified.time : 0
+                }
+            }
+        }
+        return inputs
+    }
+
+    /*
+        Run one client build request in the daemon. Output is written to the client which receives the exit status last.
+        The prepare function reloads the DOM if required.
+     */
+    private function serveDaemon(client: Socket, prepare: Function) {
+        let buf = new ByteArray
+        let text = ''
+        while (!text.contains('\n') && client.read(buf) > 0) {
+            text += buf.readString()
+        }
+        let request
+        try {
+            request = deserialize(text)
+        } catch {
+            client.close()
+            return
+        }
+        let saved = {}
+        for each (key in DaemonOptions) {
+            saved[key] = options[key]
+            options[key] = request.options[key]
+        }
+        let log = App.log
+        let prior = out
+        out = client
+        App.log = new Logger(log.name, client, log.level)
+        status = 0
+        try {
+            prepare()
+            let goals = request.goals
+            builder.build(goals)
+            if (goals != 'version') {
+                trace('Complete', goals)
+            }
+        } catch (e) {
+            App.log.error('' + ((options.diagnose || !(e is Error)) ? e : e.message) + '\n')
+            status ||= 2
+        } finally {
+            try {
+                client.write(DaemonStatus + status + '\n')
+            } catch {}
+            client.close()
+            App.log = log
+            out = prior
+            blend(options, saved)
+        }
+    }
+
+    /*
+        Run a compile worker for "me --workers" builds. Clients post locally preprocessed sources with the compiler
+        name and flags. The worker locates the compiler and builds the command itself. Each job is compiled in its own
+        temporary directory and the response returns the compiler output followed by the object file. Workers also
+        serve the object cache.
+     */
+    function worker() {
+        if (!options.worker.match(/^[^:*]+:\d+$/)) {
+            throw 'The worker listen address must be IP:PORT, for example 10.0.0.5:4100'
+        }
+        let server = new HttpServer
+        server.setLimits(WorkerLimits)
+        let seq = 0
+        server.on('readable', function(event, request) {
+            request.dontAutoFinalize()
+            let source = new ByteArray
+            let done = false
+            request.on('readable', function(event, request) {
+                let buf = new ByteArray
+                let count
+                while ((count = request.read(buf)) > 0) {
+                    source.write(buf)
+                    buf.flush()
+                }
+                if (count == null && !done) {
+                    done = true
+                    if (request.pathInfo.startsWith('/cache/')) {
+                        makeme.serveCache(request, source)
+                    } else {
+                        let jobDir = Path(App.getenv('TMPDIR') || '/tmp').join('makeme-job-' + App.pid + '-' + ++seq)
+                        makeme.serveWorker(request, source, jobDir)
+                    }
+                }
+            })
+        })
+        server.listen(options.worker)
+        trace('Worker', 'Listening at ' + options.worker)
+        App.run()
+    }
+
+    /*
+        Serve the object cache. Objects are stored by key in the default local object cache directory.
+        GET /cache/KEY returns an object and PUT /cache/KEY stores an object. Uploads are only accepted if the worker
+        has a MAKEME_CACHE_TOKEN and the request has the same token in the X-MakeMe-Token header.
+     */
+    function serveCache(request: Request, body: ByteArray) {
+        let key = request.pathInfo.slice(7)
+        let path = ObjectCache.join(key.slice(0, 2), key + '.o')
+        if (!key.match(/^[0-9a-f]{64}$/)) {
+            request.status = Http.BadRequest
+
+        } else if (request.method == 'GET') {
+            if (path.exists) {
+                request.setHeader('Content-Type', 'application/octet-stream')
+                request.write(path.readBytes())
+            } else {
+                request.status = Http.NotFound
+            }
+
+        } else if (request.method == 'PUT') {
+            let token = App.getenv(CacheToken)
+            if (!token || request.header('X-MakeMe-Token') != token) {
+                request.status = Http.Forbidden
+                request.finalize()
+                return
+            }
+            let tmp = path.dirname.join('tmp-' + App.pid + '-' + path.basename)
+            path.dirname.makeDir()
+            let file = new File(tmp, 'w')
+            file.write(body)
+            file.close()
+            tmp.rename(path)
+            request.status = Http.Created
+        } else {
+            request.status = Http.BadMethod
+        }
+        request.finalize()
+    }
+
+    /*
+        Compile one posted job. Responds with the X-MakeMe-Status header set to the compiler exit status and the
+        X-MakeMe-Output header set to the length of the compiler output that prefixes the object file in the body.
+     */
+    function serveWorker(request: Request, source: ByteArray, jobDir: Path) {
+        let compiler = request.header('X-MakeMe-Compiler') || ''
+        let flags, program
+        try {
+            flags = deserialize(request.header('X-MakeMe-Flags') || '')
+        } catch {}
+        if (request.method == 'POST' && WorkerCompilers.test(compiler) && MakeMe.acceptWorkerFlags(flags)) {
+            program = Cmd.locate(compiler)
+        }
+        if (!program) {
+            request.status = Http.BadRequest
+            request.write('Bad compile job\n')
+            request.finalize()
+            return
+        }
+        let identity = workerIdentity(program)
+        if (!identity || request.header('X-MakeMe-Identity') != identity) {
+            request.status = Http.BadRequest
+            request.write('Compiler ' + compiler + ' differs from the compiler on this worker\n')
+            request.finalize()
+            return
+        }
+        let command = [program, '-c', '-o', 'job.o'] + flags + ['job.i']
+        jobDir.makeDir()
+        let file = new File(jobDir.join('job.i'), 'w')
+        file.write(source)
+        file.close()
+        vtrace('Compile', command.join(' '))
+        let cmd = new Cmd
+        cmd.on('complete', function(event, cmd) {
+            let output = new ByteArray
+            output.write(cmd.readString() || '', cmd.error || '')
+            let obj = jobDir.join('job.o')
+            let status = cmd.status
+            if (status == 0 && !obj.exists) {
+                status = 1
+            }
+            request.setHeader('Content-Type', 'application/octet-stream')
+            request.setHeader('X-MakeMe-Identity', identity)
+            request.setHeader('X-MakeMe-Status', status)
+            request.setHeader('X-MakeMe-Output', output.length)
+            request.write(output)
+            if (status == 0) {
+                request.write(obj.readBytes())
+            }
+            request.finalize()
+            jobDir.removeAll()
+        })
+        cmd.start(command, {dir: jobDir, detach: true})
+        cmd.finalize()
+    }
+
+    /*
+        Return the identity of a worker compiler. This is recomputed if the compiler is modified.
+     */
+    function workerIdentity(program: Path): String? {
+        let modified = program.modified
+        let entry = identities[program]
+        if (!entry || entry.modified != modified.time) {
+            try {
+                entry = identities[program] = { modified: modified.time, identity: MakeMe.compilerIdentity(program) }
+            } catch (e) {
+                trace('Warn', 'Cannot identify compiler ' + program + ': ' + e)
+                return null
+            }
+        }
+        return entry.identity
+    }
+
+    /**
+        Identify a compiler by a digest of its version and target machine. Compile workers only accept jobs from
+        clients with the same compiler identity, and objects are cached under it.
+        @param program Compiler program
+        @return Digest string
+        @hide
+     */
+    public static function compilerIdentity(program: Path): String {
+        /* Clang reports its install directory which may differ between otherwise identical machines */
+        let version = Cmd.run([program, '--version']).replace(/^InstalledDir:.*$/m, '')
+        let machine = Cmd.run([program, '-dumpmachine'])
+        return Digest().update(version, '\n', machine.trim()).digest()
+    }
+
+    /**
+        Test if compiler flags may be sent to a worker
+        @param flags Array of flags
+        @return True if every flag is accepted
+        @hide
+     */
+    public static function acceptWorkerFlags(flags): Boolean {
+        if (!(flags is Array)) {
+            return false
+        }
+        for each (flag in flags) {
+            if (!(flag is String) || !WorkerFlags.test(flag) || WorkerDeniedFlags.test(flag)) {
+                return false
+            }
+        }
+        return true
+    }
+
     function import() {
         me = Me()
         loader.loadFile(Loader.START)
@@ -517,10 +966,12 @@ public class MakeMe {
         print('\nUsage: me [options] [targets|goals] ...\n' +
             '  Options:\n' +
             '  --benchmark                               # Measure elapsed time\n' +
+            '  --cache URL                               # Use a remote object cache\n' +
             '  --chdir directory                         # Change to directory first\n' +
             '  --configure /path/to/source/tree          # Configure product\n' +
             '  --configuration                           # Display current configuration\n' +
             '  --continue                                # Continue on errors\n' +
+            '  --daemon                                  # Run a resident build server for this tree\n' +
             '  --debug                                   # Enable debug build\n' +
             '  --deploy directory                        # Install to deploy directory\n' +
             '  --depth level                             # Set utest depth level\n' +
@@ -529,7 +980,7 @@ public class MakeMe {
             '  --endian [big|little]                     # Define the CPU endianness\n' +
             '  --file file.me                            # Use the specified MakeMe file\n' +
             '  --force                                   # Override warnings\n' +
-            '  --gen [make|nmake|sh|vs|xcode|main|start] # Generate project file\n' +
+            '  --gen [make|nmake|ninja|sh|vs|xcode|main|start] # Generate project file\n' +
             '  --get field                               # Get and display a me field value\n' +
             '  --help                                    # Print help message\n' +
             '  --import                                  # Import standard me environment\n' +
@@ -540,6 +991,7 @@ public class MakeMe {
             '  --nolocal                                 # Build cross only\n' +
             '  --overwrite                               # Overwrite existing files\n' +
             '  --out path                                # Save output to a file\n' +
+            '  --pgo                                     # Build with profile guided optimization\n' +
             '  --platform os-arch-profile                # Build for specified platform\n' +
             '  --pre                                     # Pre-process a source file to stdout\n' +
             '  --prefix dir=path                         # Define installation path prefixes\n' +
@@ -553,6 +1005,7 @@ public class MakeMe {
             '  --sets [set,set,..]                       # File set to install/deploy\n' +
             '  --show                                    # Show commands executed\n' +
             '  --static                                  # Make static libraries\n' +
+            '  --stats                                   # Report the most expensive commands\n' +
             '  --unicode                                 # Set char size to wide (unicode)\n' +
             '  --unset feature                           # Unset a feature\n' +
             '  --version                                 # Display the me version\n' +
@@ -561,6 +1014,8 @@ public class MakeMe {
             '  --why                                     # Why a target was or was not built\n' +
             '  --with NAME[=PATH]                        # Build with package at PATH\n' +
             '  --without NAME                            # Build without a package\n' +
+            '  --worker ip:port                          # Run a compile worker for remote builds\n' +
+            '  --workers host:port,...                   # Compile C sources on remote workers\n' +
             '')
 
         let me = Me()
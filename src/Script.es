@@ -151,6 +151,7 @@ public function changeDir(path: Path) {
     @param src Source file
     @param dest Destination
     @param options Options to pass to Me.copy(). These include user, group, uid, gid and  permissions.
+        Set hardlink to true to link to the source file instead of copying where possible.
 */
 public function copyFile(src: Path, dest: Path, options = {}) {
     if (!makeme.generating) {
@@ -159,6 +160,12 @@ public function copyFile(src: Path, dest: Path, options = {}) {
             throw new Error('Cannot copy file. Source is the same as destination: ' + src)
         }
         if (!options.dry) {
+            if (options.hardlink) {
+                try {
+                    src.link(dest, true)
+                    return
+                } catch {}
+            }
             src.copy(dest)
         }
         if ((options.user || options.group || options.uid || options.gid) && App.uid == 0) {
@@ -230,21 +237,39 @@ public function copyFiles(from, to: Path, topOptions = {}, base = null) {
         /* If generating, keep the pattern */
         missing: makeme.generating ? '' : undefined,
 
-        postPerform: function (from, to, control) {
-            if (control.filelist && !to.isDir) {
-                control.filelist.push(to)
-            }
-            if (control.fold) {
-                strace('Fold', to)
-                foldLines(to)
-            }
-            if (!control.verbose) {
-                if (makeme.options.show) {
-                    strace('Copy', 'cp ' + from + ' ' + to)
+        /*
+            Only provide post processing if required so Path.operate can copy without per-file callbacks
+         */
+        postPerform: (topOptions.filelist || topOptions.fold || makeme.options.show) ? postPerform : null
+    }, topOptions, {overwrite: false, functions: true})
+
+    function postPerform(from, to, control) {
+        if (control.filelist && !to.isDir) {
+            control.filelist.push(to)
+            if (control.symlink && Config.OS != 'windows') {
+                /* Path.operate links the destination into the symlink directory or path */
+                let link = Path(control.symlink)
+                if (link.name.endsWith('/') || link.isDir) {
+                    link = link.join(to.basename)
                 }
+                control.filelist.push(link)
             }
         }
-    }, topOptions, {overwrite: false, functions: true})
+        if (control.fold) {
+            strace('Fold', to)
+            foldLines(to)
+        }
+        if (!control.verbose) {
+            if (makeme.options.show) {
+                strace('Copy', 'cp ' + from + ' ' + to)
+            }
+        }
+    }
+
+    if (options.fold) {
+        /* Folding rewrites the destination in place */
+        options.hardlink = options.update = false
+    }
 
     if (makeme.generating) {
         /*
@@ -739,13 +764,6 @@ public function genRawWriteLine(...args) {
     genout.writeLine()
 }
 
-internal function rep(s: String, pattern, replacement): String {
-    if (pattern) {
-        s = s.replace(pattern, replacement)
-    }
-    return s
-}
-
 internal function repset(s: String, patterns) {
     for each (pattern in patterns) {
         let [from, to] = pattern
@@ -756,14 +774,105 @@ internal function repset(s: String, patterns) {
     return s
 }
 
-internal function repCmd(s: String, pattern, replacement): String {
-    if (s.startsWith(pattern)) {
-        return s.replace(pattern, replacement)
+/*
+    Substitution tables combine a list of patterns into a single alternation RegExp so a command can be rewritten
+    in one pass. Each entry has a 'pattern' (RegExp source), a replacement template 'to' and an optional 'count' that
+    limits the number of replacements (String.replace with a string pattern replaces only the first occurrence).
+    Entries with the same 'key' share a count.
+    Tables depend on the generator mappings and are cached in Generate.substitutions which is reset per platform.
+ */
+internal function subTable(key: String, fn: Function): Object {
+    let cache = makeme.generate.substitutions
+    return cache[key] ||= compileSubs(fn())
+}
+
+internal function compileSubs(entries: Array): Object {
+    entries = entries.filter(function(e) e.pattern)
+    if (entries.length == 0) {
+        return { entries: entries }
     }
-    if (s.startsWith('"' + pattern + '"')) {
-        return s.replace(pattern, replacement)
+    let source = entries.map(function(e) '(' + nocapture(e.pattern) + ')').join('|')
+    return { entries: entries, re: RegExp(source, 'g') }
+}
+
+internal function applySubs(s: String, table, counts = {}): String {
+    if (!table.re) {
+        return s
     }
-    return s
+    let entries = table.entries
+    return s.replace(table.re, function(matched, ...groups) {
+        for (let i = 0; i < entries.length; i++) {
+            if (groups[i]) {
+                let entry = entries[i]
+                if (entry.count) {
+                    let key = entry.key || entry.pattern
+                    counts[key] = (counts[key] || 0) + 1
+                    if (counts[key] > entry.count) {
+                        /* Exhausted, so apply the other entries to the matched text */
+                        table.rest ||= {}
+                        let rest = table.rest[i] ||= compileSubs(entries.slice(0, i) + entries.slice(i + 1))
+                        return applySubs(matched, rest, counts).replace(/\$/g, '$$$$')
+                    }
+                }
+                return entry.to
+            }
+        }
+        return matched.replace(/\$/g, '$$$$')
+    })
+}
+
+/*
+    Entry for a literal string pattern. The replacement is literal text.
+ */
+internal function literal(pattern, to: String, count: Number = 1): Object {
+    if (!pattern) {
+        return {}
+    }
+    return { pattern: pattern.toString().replace(/[\\^$.*+?()[\]{}|]/g, '\\$&'), to: to.replace(/\$/g, '$$$$'),
+        count: count }
+}
+
+/*
+    Convert capturing groups in a pattern to non-capturing so that group numbers identify table entries
+ */
+internal function nocapture(pattern: String): String
+    pattern.replace(/\\.|\((?!\?)/g, function(m) (m == '(') ? '(?:' : m.replace(/\$/g, '$$$$'))
+
+/*
+    Entries to replace a command program at the start of the command line
+ */
+internal function programSubs(path, to: String): Array {
+    if (!path) {
+        return []
+    }
+    let pattern = literal(path, '').pattern
+    return [
+        { pattern: '^' + pattern, to: to.replace(/\$/g, '$$$$'), count: 1 },
+        { pattern: '^"' + pattern + '"', to: '"' + to.replace(/\$/g, '$$$$') + '"', count: 1 },
+    ]
+}
+
+/*
+    Reference to a generated project variable in replacement template form. Ninja uses ${NAME}.
+ */
+internal function genVar(name: String): String
+    (makeme.generating == 'ninja') ? ('$${' + name + '}') : ('$$(' + name + ')')
+
+/*
+    Entries to replace installation prefixes with ME_*_PREFIX variables
+ */
+internal function prefixSubs(prefixes): Array {
+    let entries = []
+    for each (p in ['vapp', 'app', 'bin', 'inc', 'lib', 'man', 'base', 'web', 'cache', 'spool', 'log', 'etc']) {
+        if (prefixes[p] && prefixes[p].toString() != '') {
+            let to = genVar('ME_' + p.toUpper() + '_PREFIX')
+            if (me.platform.like == 'windows') {
+                entries.push({ pattern: prefixes[p].windows.replace(/\\/g, '\\\\'), to: to })
+            }
+            entries.push({ pattern: prefixes[p].toString(), to: to })
+        }
+    }
+    return entries
 }
 
 /**
@@ -772,90 +881,67 @@ internal function repCmd(s: String, pattern, replacement): String {
     @hide
  */
 public function repcmd(command: String): String {
-    //  generator.settings == gen
-    let mappings = makeme.generate.mappings
     let generating = makeme.generating
-    let minimalCflags = makeme.generate.minimalCflags
-    if (generating == 'make' || generating == 'nmake') {
-        if (mappings.linker != '') {
+    let table = subTable('repcmd-' + generating, function() {
+        let mappings = makeme.generate.mappings
+        let minimalCflags = makeme.generate.minimalCflags
+        let entries = []
+        let open = (generating == 'sh' || generating == 'ninja') ? '${' : '$('
+        let close = (generating == 'sh' || generating == 'ninja') ? '}' : ')'
+        if (generating == 'make' || generating == 'nmake' || generating == 'sh' || generating == 'ninja') {
+            let words = minimalCflags.map(function(word) literal(word + ' ', ' '))
+            let c = ' -c '
+            if (mappings.compiler == '') {
+                c += open + 'CFLAGS' + close + ' '
+            }
+            if (mappings.defines == '') {
+                c += open + 'DFLAGS' + close + ' '
+            }
+            if (me.targets.compiler) {
+                entries += programSubs(me.targets.compiler.path, open + 'CC' + close)
+            }
+            if (me.targets.link) {
+                entries += programSubs(me.targets.link.path, open + 'LD' + close)
+            }
+            if (me.targets.rc && generating != 'sh') {
+                entries += programSubs(me.targets.rc.path, open + 'RC' + close)
+            }
             /* Linker has -g which is also in minimal C flags */
-            command = rep(command, mappings.linker, '$(LDFLAGS)')
-        }
-        if (mappings.defines != '') {
-            command = rep(command, mappings.defines, '$(DFLAGS)')
-        } else {
-            command = rep(command, ' -c ', ' -c $(DFLAGS) ')
-        }
-        if (mappings.compiler != '') {
-            command = rep(command, mappings.compiler, '$(CFLAGS)')
-        } else {
-            command = rep(command, ' -c ', ' -c $(CFLAGS) ')
-        }
-        for each (word in minimalCflags) {
-            command = rep(command, word + ' ', ' ')
-        }
-        command = rep(command, mappings.libpaths, '$(LIBPATHS)')
-        command = rep(command, mappings.includes, '$(IFLAGS)')
-        command = rep(command, '"$(IFLAGS)"', '$(IFLAGS)')
-        /* Twice because libraries are repeated and replace only changes the first occurrence */
-        command = rep(command, mappings.libraries, '$(LIBS)')
-        command = rep(command, mappings.libraries, '$(LIBS)')
-        command = rep(command, RegExp(mappings.build, 'g'), '$$(BUILD)')
-        command = rep(command, RegExp(mappings.configuration, 'g'), '$$(CONFIG)')
-        if (me.targets.compiler) {
-            command = repCmd(command, me.targets.compiler.path, '$(CC)')
-        }
-        if (me.targets.link) {
-            command = repCmd(command, me.targets.link.path, '$(LD)')
-        }
-        if (me.targets.rc) {
-            command = repCmd(command, me.targets.rc.path, '$(RC)')
-        }
-
-    } else if (generating == 'sh') {
-        if (mappings.linker != '') {
-            command = rep(command, mappings.linker, '${LDFLAGS}')
-        }
-        for each (word in minimalCflags) {
-            command = rep(command, word + ' ', ' ')
-        }
-        if (mappings.defines != '') {
-            command = rep(command, mappings.defines, '${DFLAGS}')
-        } else {
-            command = rep(command, ' -c ', ' -c ${DFLAGS} ')
-        }
-        if (mappings.compiler != '') {
-            command = rep(command, mappings.compiler, '${CFLAGS}')
-        } else {
-            command = rep(command, ' -c ', ' -c ${CFLAGS} ')
-        }
-        if (mappings.linker != '') {
-            command = rep(command, mappings.linker, '${LDFLAGS}')
-        }
-        command = rep(command, mappings.libpaths, '${LIBPATHS}')
-        command = rep(command, mappings.includes, '${IFLAGS}')
-        /* Twice because libraries are repeated and replace only changes the first occurrence */
-        command = rep(command, mappings.libraries, '${LIBS}')
-        command = rep(command, mappings.libraries, '${LIBS}')
-        command = rep(command, RegExp(mappings.build, 'g'), '$${BUILD}')
-        command = rep(command, RegExp(mappings.configuration, 'g'), '$${CONFIG}')
-        if (me.targets.compiler) {
-            command = repCmd(command, me.targets.compiler.path, '${CC}')
-        }
-        if (me.targets.link) {
-            command = repCmd(command, me.targets.link.path, '${LD}')
+            entries.push(literal(mappings.linker, open + 'LDFLAGS' + close))
+            if (generating == 'sh') {
+                entries += words
+            }
+            entries.push(literal(mappings.defines, open + 'DFLAGS' + close))
+            entries.push(literal(mappings.compiler, open + 'CFLAGS' + close))
+            if (c != ' -c ') {
+                entries.push(literal(' -c ', c))
+            }
+            if (generating != 'sh') {
+                entries += words
+            }
+            entries.push(literal(mappings.libpaths, open + 'LIBPATHS' + close))
+            let includes = literal(mappings.includes, open + 'IFLAGS' + close)
+            if (generating != 'sh' && mappings.includes) {
+                /* Quoted includes share the count of the unquoted entry */
+                entries.push(blend(literal('"' + mappings.includes + '"', open + 'IFLAGS' + close), { key: includes.pattern }))
+            }
+            entries.push(includes)
+            /* Twice because libraries are repeated */
+            entries.push(literal(mappings.libraries, open + 'LIBS' + close, 2))
+            if (generating != 'sh') {
+                entries.push({ pattern: mappings.build, to: genVar('BUILD') })
+            }
+            entries.push({ pattern: mappings.configuration, to: '$$' + open + 'CONFIG' + close })
         }
-        for each (word in minimalCflags) {
-            command = rep(command, word + ' ', ' ')
+        if (generating == 'nmake') {
+            entries.push(literal('_DllMainCRTStartup@12', '$(ENTRY)'))
         }
-    }
-    if (generating == 'nmake') {
-        command = rep(command, '_DllMainCRTStartup@12', '$(ENTRY)')
-    }
-    command = rep(command, RegExp(me.dir.top + '/', 'g'), '')
-    command = rep(command, /  */g, ' ')
+        entries.push({ pattern: me.dir.top + '/', to: '' })
+        return entries
+    })
+    command = applySubs(command, table).replace(/  */g, ' ')
     if (generating == 'nmake') {
-        command = rep(command, /\//g, '\\')
+        command = command.replace(/\//g, '\\')
     }
     return command
 }
@@ -866,61 +952,45 @@ public function repcmd(command: String): String {
  */
 public function repvar(command: String): String {
     let generating = makeme.generating
-    let mappings = makeme.generate.mappings
-    command = command.replace(RegExp(me.dir.top + '/', 'g'), '')
-    if (generating == 'make') {
-        command = command.replace(RegExp(mappings.build, 'g'), '$$(BUILD)')
-        command = command.replace(RegExp(mappings.configuration, 'g'), '$$(CONFIG)')
-    } else if (generating == 'nmake') {
-        command = command.replace(RegExp(mappings.build, 'g'), '$$(BUILD)')
-        command = command.replace(RegExp(mappings.configuration, 'g'), '$$(CONFIG)')
-    } else if (generating == 'sh') {
-        command = command.replace(RegExp(mappings.configuration, 'g'), '$${CONFIG}')
-    }
-    for each (p in ['vapp', 'app', 'bin', 'inc', 'lib', 'man', 'base', 'web', 'cache', 'spool', 'log', 'etc']) {
-        if (me.prefixes[p] && me.prefixes[p].toString() != '') {
-            if (me.platform.like == 'windows') {
-                let pat = me.prefixes[p].windows.replace(/\\/g, '\\\\')
-                command = command.replace(RegExp(pat, 'g'), '$$(ME_' + p.toUpper() + '_PREFIX)')
-            }
-            command = command.replace(RegExp(me.prefixes[p], 'g'), '$$(ME_' + p.toUpper() + '_PREFIX)')
+    let table = subTable('repvar-' + generating, function() {
+        let mappings = makeme.generate.mappings
+        let entries = [{ pattern: me.dir.top + '/', to: '' }]
+        if (generating == 'make' || generating == 'nmake' || generating == 'ninja') {
+            entries.push({ pattern: mappings.build, to: genVar('BUILD') })
+            entries.push({ pattern: mappings.configuration, to: genVar('CONFIG') })
+        } else if (generating == 'sh') {
+            entries.push({ pattern: mappings.configuration, to: '$${CONFIG}' })
         }
-    }
-    command = command.replace(/\/\//g, '$$(ME_ROOT_PREFIX)/')
-    return command
+        return entries + prefixSubs(me.prefixes)
+    })
+    return applySubs(command, table).replace(/\/\//g, genVar('ME_ROOT_PREFIX') + '/')
 }
 
 public function repvar2(command: String, home: Path? = null): String {
     let generating = makeme.generating
-    let mappings = makeme.generate.mappings
-    if (home) {
-        command = command.replace(RegExp(me.dir.top, 'g'), me.dir.top.relativeTo(home))
-    }
-    if (home && me.platform.like == 'windows' && generating == 'nmake') {
-        let re = RegExp(me.dir.top.windows.name.replace(/\\/g, '\\\\'), 'g')
-        command = command.replace(re, me.dir.top.relativeTo(home).windows)
-    }
-    if (generating == 'make') {
-        command = command.replace(RegExp(mappings.build, 'g'), '$$(BUILD)')
-        command = command.replace(RegExp(mappings.configuration, 'g'), '$$(CONFIG)')
-    } else if (generating == 'nmake') {
-        command = command.replace(RegExp(mappings.configuration + '\\\\bin/', 'g'), '$$(CONFIG)\\bin\\')
-        command = command.replace(RegExp(mappings.build, 'g'), '$$(BUILD)')
-        command = command.replace(RegExp(mappings.configuration, 'g'), '$$(CONFIG)')
-    } else if (generating == 'sh') {
-        command = command.replace(RegExp(mappings.configuration, 'g'), '$${CONFIG}')
-    }
-    for each (p in ['vapp', 'app', 'bin', 'inc', 'lib', 'man', 'base', 'web', 'cache', 'spool', 'log', 'etc']) {
-        if (mappings[p] && mappings[p].toString() != '') {
-            if (me.platform.like == 'windows') {
-                let pat = mappings[p].windows.replace(/\\/g, '\\\\')
-                command = command.replace(RegExp(pat, 'g'), '$$(ME_' + p.toUpper() + '_PREFIX)')
+    let table = subTable('repvar2-' + generating + '-' + home, function() {
+        let mappings = makeme.generate.mappings
+        let entries = []
+        if (home) {
+            entries.push({ pattern: me.dir.top.toString(), to: me.dir.top.relativeTo(home).toString() })
+            if (me.platform.like == 'windows' && generating == 'nmake') {
+                entries.push({ pattern: me.dir.top.windows.name.replace(/\\/g, '\\\\'),
+                    to: me.dir.top.relativeTo(home).windows.toString() })
             }
-            command = command.replace(RegExp(mappings[p], 'g'), '$$(ME_' + p.toUpper() + '_PREFIX)')
         }
-    }
-    command = command.replace(/\/\//g, '$$(ME_ROOT_PREFIX)/')
-    return command
+        if (generating == 'make' || generating == 'ninja') {
+            entries.push({ pattern: mappings.build, to: genVar('BUILD') })
+            entries.push({ pattern: mappings.configuration, to: genVar('CONFIG') })
+        } else if (generating == 'nmake') {
+            entries.push({ pattern: mappings.configuration + '\\\\bin/', to: '$$(CONFIG)\\bin\\' })
+            entries.push({ pattern: mappings.build, to: '$$(BUILD)' })
+            entries.push({ pattern: mappings.configuration, to: '$$(CONFIG)' })
+        } else if (generating == 'sh') {
+            entries.push({ pattern: mappings.configuration, to: '$${CONFIG}' })
+        }
+        return entries + prefixSubs(mappings)
+    })
+    return applySubs(command, table).replace(/\/\//g, genVar('ME_ROOT_PREFIX') + '/')
 }
 
 public function reppath(path: Path): String {
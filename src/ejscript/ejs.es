@@ -802,6 +802,15 @@ module ejs {
          */
         native function append(obj: Object): Array
 
+        /**
+            Append the elements of an array that are not already in this array. Duplicates are detected as for 
+            unique(). Existing elements keep their order and new elements are added at the end in their original order.
+            @param items Array of elements to append.
+            @return The array itself.
+            @spec ejs
+         */
+        native function appendUnique(items: Array): Array
+
         /**
             Clear an array. Remove all elements of the array.
             @spec ejs
@@ -2631,6 +2640,14 @@ module ejs {
          */
         native function write(...data): Number
 
+        /**
+            Resource usage of the completed command. This is supported on Linux, Mac OS X and FreeBSD.
+            @return An object with $user and $sys properties for the CPU time in milliseconds and a $rss property for
+                the maximum resident set size in bytes. Returns null if the command has not completed or the usage
+                is not available.
+         */
+        native function get usage(): Object?
+
 
         /* Static Helper Methods */
 
@@ -8726,6 +8743,8 @@ module ejs {
                 If both user and uid are specified, user takes precedence. 
             @options group String representing the file group name or numeric group id.
                 If both group and gid are specified, group takes precedence.
+            @options update Boolean | String Set to true to skip the copy if the destination is the same size and newer 
+                than the file. Set to 'contents' to skip the copy only if the destination has the same contents.
          */
         native function copy(destination: Object, options: Object? = null): Void
 
@@ -9435,6 +9454,10 @@ module ejs {
 
             @option group String | Number System group name or number to use for the destination files.
 
+            @option hardlink Boolean Copy files by creating hard links to the source files where possible. This falls back
+                to copying if a link cannot be created, e.g. across file systems. The destination shares the source
+                file, so its attributes are not modified. Ignored if 'patch' or 'strip' are used.
+
             @option header String Header prepend when appending files.
 
             @option isDir Assume the destination is a directory. Create if it does not exist. Same as appending a 
@@ -9478,6 +9501,10 @@ module ejs {
             @option trim Number of path components to trim from the start of the source filename. 
                 If set, implies flatten == false.
 
+            @option update Boolean | String Only copy files that have changed. Destinations that are the same size and 
+                newer than the source are not copied. Set to 'contents' to compare the contents of destinations 
+                instead of their modified times. Ignored if 'patch' or 'strip' are used.
+
             @option user String | Number System user account name or number to use for destination files.
 
             @option verbose true | function. If true, then trace to stdout. Otherwise call function for each item.
@@ -9511,6 +9538,26 @@ module ejs {
             }
             let srcHash = {}
             let commands = []
+            let copied = 0
+
+            function copyFile(src: Path, dest: Path, options) {
+                if (options.hardlink) {
+                    try {
+                        src.link(dest, true)
+                        return
+                    } catch {}
+                }
+                try {
+                    src.copy(dest, options)
+                } catch (e) {
+                    if (options.active && Config.OS == 'windows' && dest.exists && !dest.isDir) {
+                        let active = dest.replaceExt('old')
+                        active.remove()
+                        try { dest.rename(active) } catch {}
+                    }
+                    src.copy(dest, options)
+                }
+            }
 
             for each (options in instructions) {
                 if (options.append) {
@@ -9522,6 +9569,10 @@ module ejs {
                 if (options.flatten == undefined) {
                     options.flatten = true
                 }
+                if (options.patch || options.strip) {
+                    /* Destinations modified in place cannot be linked to or compared with the source */
+                    options.hardlink = options.update = false
+                }
                 //  LEGACY 
                 if (options.cat) {
                     print('Warn: using legacy "cat" property for Path.operate, use "append" instead.')
@@ -9574,6 +9625,14 @@ module ejs {
                     }
                     return list
                 }
+                if (operation == 'copy' && !trace && !options.perform && !options.action && !options.prePerform &&
+                        !options.postPerform && !options.rename && !options.relative && !options.trim && 
+                        !options.extension && !options.patch && !options.strip && !options.compress && 
+                        !options.symlink && !options.hardlink && !options.active && !options.dry && !options.debug) {
+                    /* Plain copies without callbacks are performed natively */
+                    copied += this.operateCopy(files, to, toDir, options, srcHash)
+                    continue
+                }
                 /* 
                     Process matching files and build list of commands
                     Note: 'src' is relative to 'this' and may not be addressible unless 'this' is '.'
@@ -9648,6 +9707,12 @@ module ejs {
                         contents.push(expand(options.header, options) + '\n')
                     }
                 }
+                /*
+                    Plain copies without per-file callbacks are collected and copied concurrently
+                 */
+                let batch = (operation == 'copy' && commands.length > 1 && !options.perform && !options.action &&
+                    !options.prePerform && !options.hardlink && !options.dry) ? {from: [], to: []} : null
+
                 /*
                     Process all qualifying files
                  */
@@ -9699,20 +9764,20 @@ module ejs {
                         }
                         if (src.isDir) {
                             dest.makeDir()
+                        } else if (batch) {
+                            batch.from.push(item.from)
+                            batch.to.push(dest)
                         } else {
-                            try {
-                                src.copy(dest, options)
-                            } catch (e) {
-                                if (options.active && Config.OS == 'windows' && dest.exists && !dest.isDir) {
-                                    let active = dest.replaceExt('old')
-                                    active.remove()
-                                    try { dest.rename(active) } catch {}
-                                }
-                                src.copy(dest, options)
-                            }
+                            copyFile(src, dest, options)
                         }
                     }
                 }
+                if (batch && batch.from.length > 0) {
+                    /* Retry failures serially to handle active files and report errors */
+                    for each (index in this.copyList(batch.from, batch.to, options)) {
+                        copyFile(this.join(batch.from[index]), batch.to[index], options)
+                    }
+                }
                 if (!options.perform) {
                     if (operation == 'append') {
                         /* Loop just once over the post processing */
@@ -9763,7 +9828,7 @@ module ejs {
                     }
                 }
             }
-            return commands.length
+            return commands.length + copied
         }
 
         /**
@@ -9872,6 +9937,38 @@ module ejs {
             let p = absolute
             return p.startsWith(home) ? p.relativeTo(home) : p
         }
+
+        /**
+            Copy a list of files concurrently. Files are copied on worker threads and use in-kernel copying where 
+            the O/S supports it. File permissions are preserved. Destination directories must already exist.
+            @param from Array of source files relative to the Path
+            @param to Array of destination filenames corresponding to the source files
+            @param options Attributes to apply to the destination files. See $setAttributes for the supported options.
+            @option threads Number of copy threads to use. Defaults to 8.
+            @option update Boolean | String Skip destinations that are current. See $copy for details.
+            @return An array of the indexes of files that could not be copied
+            @hide
+         */
+        native function copyList(from: Array, to: Array, options: Object? = null): Array
+
+        /**
+            Copy files for $operate without per-file callbacks. Files are copied concurrently using $copyList.
+            @param files Array of source files relative to the Path
+            @param to Destination file or directory
+            @param toDir Set to true if the destination is a directory
+            @param options Operate options. The flatten, threads, update and attribute options are supported.
+            @param hash Hash of source files already processed. Processed sources are added.
+            @return Count of files and directories processed
+            @hide
+         */
+        native function operateCopy(files: Array, to: Path, toDir: Boolean, options: Object, hash: Object? = null): Number
+
+        /**
+            When the path itself was last modified. Unlike $modified, symbolic links are not followed.
+            Set to null if the path does not exist.
+            @hide
+         */
+        native function get linkModified(): Date?
     }
 }
 
@@ -10384,7 +10481,8 @@ module ejs {
             connect() the socket may be used for sending and receiving.
             @param address The endpoint address on which to listen. The address can be either a port number, an IP address
                 string, a composite "IP:PORT" string or a port number string. If only a port number is provided, 
-                the socket will listen on all interfaces.
+                the socket will listen on all interfaces. On Unix systems, the address may be a Path or an absolute 
+                path string to connect to a Unix domain socket.
             @throws IOError if the connection fails. Reasons may include the socket is already bound or the host is unknown.
             @events Issues a "writable" event when the connection is complete.
          */
@@ -10416,7 +10514,8 @@ module ejs {
             client connections will be notified via "accept" events. 
             @param address The endpoint address on which to listen. The address can be either a port number, an IP address
                 string or a composite "IP:PORT" string. If only a port number is provided, the socket will listen on
-                all interfaces.
+                all interfaces. On Unix systems, the address may be a Path or an absolute path string to create and 
+                listen on a Unix domain socket. The caller should remove the socket file when finished.
             @throws ArgError if the specified listen address is not valid, and IOError for network errors.
             @event Issues a "accept" event when there is a new connection available. In response, the $accept method
                 should be called.
@@ -15937,6 +16036,88 @@ module ejs.db {
     }
 }
 
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a 
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
+
+
+/********* Start of file src/ejs.digest/Digest.es ************/
+
+/**
+    Digest.es -- Incremental message digests
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+module ejs.digest {
+
+    /**
+        Incremental message digest. Data is hashed as it is supplied so files and streams of any size can be
+        digested with bounded memory.
+        @example
+            let sum = new Digest('sha256').updateFile('file.tgz').digest()
+        @spec ejs
+        @stability prototype
+     */
+    class Digest {
+        use default namespace public
+
+        /**
+            Create a digest
+            @param algorithm Digest algorithm. Set to 'md5', 'sha1' or 'sha256'.
+            @throws ArgError if the algorithm is not supported
+         */
+        native function Digest(algorithm: String = 'sha256')
+
+        /**
+            Add data to the digest
+            @param data Data to add. ByteArrays are added from their read position to their write position.
+                Other values are converted to strings.
+            @return The digest object
+         */
+        native function update(...data): Digest
+
+        /**
+            Add the contents of a file to the digest. The file is read in fixed-size chunks.
+            @param file Path or open File object. File objects are read from their current position to the end.
+            @return The digest object
+         */
+        native function updateFile(file: Object): Digest
+
+        /**
+            Finalize the digest. The digest cannot be updated after calling this routine.
+            @return The digest as a hex string
+         */
+        native function digest(): String
+
+        /**
+            Compute the digest of a file
+            @param path File to digest
+            @param algorithm Digest algorithm. Set to 'md5', 'sha1' or 'sha256'.
+            @return The digest as a hex string
+         */
+        static function file(path: Path, algorithm: String = 'sha256'): String
+            new Digest(algorithm).updateFile(path).digest()
+    }
+}
+
+
 /*
     @copy   default
 
@@ -16062,9 +16243,11 @@ module ejs.mail {
 # Config.TAR
 module ejs.tar {
 
+    require ejs.digest
     require ejs.zlib
 
     const BlockSize = 512
+    const BufSize = 64 * 1024
 
     /*
         Operations
@@ -16105,6 +16288,16 @@ module ejs.tar {
             @option gid Group id to use instead of the file group id
             @option user User name to use instead of the file user name
             @option trim Number of filename segments to trim from the start of the filename when extracting.
+            @option compress Compress the archive when creating. Archives with a 'tgz' or 'gz' extension are always
+                compressed.
+            @option level Compression level from 0 (none) to 9 (best) when creating compressed archives.
+            @option digest Compute the MD5 and SHA-256 digests of the archive when it is created.
+                The digests are available via the $digests property.
+            @option threads Number of threads to use when compressing. Set to true to use one thread per CPU core.
+            @option update Update an existing uncompressed archive in place. Entries whose headers (name, size,
+                modification time, permissions and ownership) are unchanged are not rewritten. Changed entries that
+                occupy the same number of blocks are rewritten in place. The archive is rewritten from the first
+                entry that is added, removed or resized. Ignored for compressed archives.
          */
         function Tar(path: Path, options: Object = {}) {
             this.path = path
@@ -16114,6 +16307,16 @@ module ejs.tar {
         function get name(): Path
             this.path
 
+        /*
+            MD5 and SHA-256 digests of the archive as {md5, sha256}. Set by create() if the digest option is specified.
+         */
+        var digests: Object?
+
+        /*
+            Number of entries written by the last call to create(). Entries retained by an update are not counted.
+         */
+        var written: Number = 0
+
         private function flatten(args: Array): Array {
             let files = []
             for each (file in args) {
@@ -16129,9 +16332,44 @@ module ejs.tar {
             return files
         }
 
+        /*
+            Read the headers of an existing uncompressed archive as [{key, blocks}]. The key identifies the entry
+            contents by name, size, modification time, permissions and ownership.
+         */
+        private function index(): Array {
+            let entries = []
+            let archive = File(path, 'r')
+            try {
+                let data: ByteArray?
+                while ((data = archive.readBytes(BlockSize)) != null && data.length == BlockSize && data[0] != 0) {
+                    let header = new TarHeader(options)
+                    header.parse(data)
+                    let blocks = Math.ceil(header.size / BlockSize)
+                    entries.push({key: header.key, blocks: blocks})
+                    archive.position += blocks * BlockSize
+                }
+            } catch {
+                /* Corrupt archive. Rewrite from the first entry that cannot be matched */
+            } finally {
+                archive.close()
+            }
+            return entries
+        }
+
+        /*
+            Create the archive. Compressed archives are tarred, compressed and digested in a single pass.
+            If the update option is set, existing uncompressed archives are updated in place.
+         */
         function create(...args): Void {
-            var archive: File  = File(path, {mode: 'w', permissions: 0644})
+            let compress = path.extension == 'tgz' || path.extension == 'gz' || options.compress
+            let entries = (!compress && options.update && path.exists) ? index() : null
+            var archive = compress ? new GzipStream(path,
+                {level: options.level, digest: options.digest, threads: options.threads}) :
+                File(path, {mode: entries ? 'w+' : 'w', permissions: 0644})
+            let data = new ByteArray(BufSize, false)
             let home = App.dir
+            let position = 0
+            written = 0
             try {
                 if (options.chdir) {
                     App.chdir(options.chdir)
@@ -16142,11 +16380,25 @@ module ejs.tar {
                     }
                     let header = new TarHeader(options)
                     header.createHeader(file)
+                    let blocks = (header.type == Regular) ? Math.ceil(header.size / BlockSize) : 0
+                    if (entries) {
+                        let prior = entries.shift()
+                        if (prior && prior.key == header.key && prior.blocks == blocks) {
+                            position += (blocks + 1) * BlockSize
+                            continue
+                        }
+                        archive.position = position
+                        if (!prior || prior.blocks != blocks) {
+                            /* Entries after a resized entry have moved, so rewrite the remainder of the archive */
+                            entries = null
+                        }
+                    }
+                    written++
+                    position += (blocks + 1) * BlockSize
                     header.write(archive)
                     if (header.type == Regular) {
                         let fp = File(file, 'r')
-                        let data = new ByteArray
-                        while (fp.read(data)) {
+                        while (fp.read(data, 0, BufSize)) {
                             archive.write(data)
                         }
                         data.flush()
@@ -16161,18 +16413,17 @@ module ejs.tar {
             } finally {
                 App.chdir(home)
             }
+            if (!compress) {
+                /* Discard entries beyond the end of an updated archive */
+                archive.truncate(position)
+            }
             archive.close()
-
-            if (path.extension == 'tgz' || path.extension == 'gz') {
-                let plain = path.joinExt('plain', true)
-                path.rename(plain)
-                Zlib.compress(plain, path)
-                plain.remove()
-            } else if (options.compress) {
-                let plain = path.joinExt('plain', true)
-                path.rename(plain)
-                Zlib.compress(plain, path)
-                plain.remove()
+            if (options.digest) {
+                if (compress) {
+                    digests = {md5: archive.md5, sha256: archive.sha256}
+                } else {
+                    digests = {md5: Digest.file(path, 'md5'), sha256: Digest.file(path, 'sha256')}
+                }
             }
         }
 
@@ -16420,6 +16671,14 @@ module ejs.tar {
             return Path((prefix) ? (Path(prefix).join(name)) : name)
         }
 
+        /*
+            Key identifying the entry contents. Used to detect unchanged entries when updating archives.
+         */
+        function get key(): String {
+            return [path, mode, uid, gid, user || '', group || '', size, Math.floor(modified.time / 1000), type,
+                linkName || ''].join(':')
+        }
+
         function show(ba) {
             for (i = 0; i < ba.length; i += 16) {
                 stdout.write(['%07o    ' % [i]])
@@ -16435,7 +16694,7 @@ module ejs.tar {
                 http://www.subspacefield.org/~vax/tar_format.html
                 http://www.fileformat.info/format/tar/corion.htm
          */
-        function write(fp: File) {
+        function write(fp) {
             let ba = new ByteArray
             ba.write(name)
             ba.writePosition = 100
@@ -24745,7 +25004,14 @@ module ejs.zlib {
     class Zlib {
         use default namespace public
 
-        static native function compress(src: Path, dest: Path? = null)
+        /**
+            Compress a file using gzip
+            @param src Source filename
+            @param dest Destination filename. Defaults to the source filename with a ".gz" extension.
+            @param options Compression options. See $GzipStream for the supported options.
+         */
+        static native function compress(src: Path, dest: Path? = null, options: Object? = null)
+
         static native function uncompress(src: Path, dest: Path? = null)
 
         static native function compressBytes(data: ByteArray): ByteArray
@@ -24754,6 +25020,52 @@ module ejs.zlib {
         static native function compressString(data: String): String
         static native function uncompressString(data: String): String
     }
+
+    /**
+        Streaming gzip compression. Data written to the stream is compressed and written to the destination
+        file as it is supplied, so memory use is bounded regardless of the amount of data.
+        @spec ejs
+        @stability prototype
+     */
+    class GzipStream {
+        use default namespace public
+
+        /**
+            Create a gzip compressed file
+            @param path Destination filename
+            @param options Compression options
+            @option level Compression level from 0 (none) to 9 (best). Defaults to the zlib default level.
+            @option digest Set to true to compute the MD5 and SHA-256 digests of the compressed output as it
+                is written.
+            @option threads Number of threads to use for compression. Set to true to use one thread per CPU core.
+                When more than one thread is used, the input is divided into 128K blocks that are compressed
+                concurrently and concatenated into a single gzip stream. The output depends on the block size
+                and level, but not on the number of threads.
+         */
+        native function GzipStream(path: Path, options: Object? = null)
+
+        /**
+            Compress and write data to the file
+            @param data Data to write. ByteArrays are written from their read position to their write position.
+            @return The number of uncompressed bytes written
+         */
+        native function write(...data): Number
+
+        /**
+            Flush remaining compressed data and close the file
+         */
+        native function close(): Void
+
+        /**
+            MD5 digest of the compressed file. Set after the stream is closed if the digest option was specified.
+         */
+        native function get md5(): String?
+
+        /**
+            SHA-256 digest of the compressed file. Set after the stream is closed if the digest option was specified.
+         */
+        native function get sha256(): String?
+    }
 }
 
 
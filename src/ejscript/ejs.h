@@ -2364,6 +2364,7 @@ typedef struct EjsArray {
     EjsPot          pot;                /**< Property storage */
     EjsObj          **data;             /**< Array elements */
     int             length;             /**< Array length property */
+    MprHash         *index;             /**< Cached element index for appendUnique. Cleared when elements change */
 } EjsArray;
 
 
@@ -5156,6 +5157,7 @@ PUBLIC void     ejsDefineConfigProperties(Ejs *ejs);
 #if ME_COM_SQLITE
     PUBLIC int   ejs_db_sqlite_Init(Ejs *ejs, MprModule *mp);
 #endif
+PUBLIC int       ejs_digest_Init(Ejs *ejs, MprModule *mp);
 #if ME_COM_ZLIB
     PUBLIC int   ejs_zlib_Init(Ejs *ejs, MprModule *mp);
 #endif
@@ -177,6 +177,58 @@
 #endif
 
 
+/********* Start of file ../inc/ejs.digest.slots.h ************/
+
+/*
+   ejs.digest.slots.h -- Native property slot definitions for the "ejs.digest" module
+  
+   This file is generated by ejsmod
+  
+   Slot definitions. Version 2.7.5.
+ */
+
+#ifndef _h_SLOTS_EjsDigestSlots
+#define _h_SLOTS_EjsDigestSlots 1
+
+
+/*
+   Slots for the "ejs.digest" module 
+ */
+
+/*
+   Prototype (instance) slots for "global" type 
+ */
+
+
+/*
+    Class property slots for the "Digest" type 
+ */
+#define ES_ejs_digest_Digest_file                                      0
+#define ES_ejs_digest_Digest_NUM_CLASS_PROP                            1
+
+/*
+   Prototype (instance) slots for "Digest" type 
+ */
+#define ES_ejs_digest_Digest_update                                    0
+#define ES_ejs_digest_Digest_updateFile                                1
+#define ES_ejs_digest_Digest_digest                                    2
+#define ES_ejs_digest_Digest_NUM_INSTANCE_PROP                         3
+#define ES_ejs_digest_Digest_NUM_INHERITED_PROP                        0
+
+/*
+    Local slots for methods in type "Digest" 
+ */
+#define ES_ejs_digest_Digest_Digest_algorithm                          0
+#define ES_ejs_digest_Digest_update_data                               0
+#define ES_ejs_digest_Digest_updateFile_file                           0
+#define ES_ejs_digest_Digest_file_path                                 0
+#define ES_ejs_digest_Digest_file_algorithm                            1
+
+#define _ES_CHECKSUM_ejs_digest   9717
+
+#endif
+
+
 /********* Start of file ../inc/ejs.slots.h ************/
 
 /*
@@ -519,42 +571,43 @@
    Prototype (instance) slots for "Array" type 
  */
 #define ES_Array_append                                                0
-#define ES_Array_clear                                                 1
-#define ES_Array_clone                                                 2
-#define ES_Array_compact                                               3
-#define ES_Array_concat                                                4
-#define ES_Array_contains                                              5
-#define ES_Array_every                                                 6
-#define ES_Array_filter                                                7
-#define ES_Array_find                                                  8
-#define ES_Array_findAll                                               9
-#define ES_Array_forEach                                               10
-#define ES_Array_iterator_get                                          11
-#define ES_Array_iterator_getValues                                    12
-#define ES_Array_indexOf                                               13
-#define ES_Array_insert                                                14
-#define ES_Array_join                                                  15
-#define ES_Array_lastIndexOf                                           16
-#define ES_Array_length                                                17
-#define ES_Array_map                                                   18
-#define ES_Array_pop                                                   19
-#define ES_Array_push                                                  20
-#define ES_Array_reduce                                                21
-#define ES_Array_reduceRight                                           22
-#define ES_Array_reject                                                23
-#define ES_Array_remove                                                24
-#define ES_Array_removeElements                                        25
-#define ES_Array_reverse                                               26
-#define ES_Array_shift                                                 27
-#define ES_Array_slice                                                 28
-#define ES_Array_some                                                  29
-#define ES_Array_sort                                                  30
-#define ES_Array_splice                                                31
-#define ES_Array_toString                                              32
-#define ES_Array_transform                                             33
-#define ES_Array_unique                                                34
-#define ES_Array_unshift                                               35
-#define ES_Array_NUM_INSTANCE_PROP                                     36
+#define ES_Array_appendUnique                                          1
+#define ES_Array_clear                                                 2
+#define ES_Array_clone                                                 3
+#define ES_Array_compact                                               4
+#define ES_Array_concat                                                5
+#define ES_Array_contains                                              6
+#define ES_Array_every                                                 7
+#define ES_Array_filter                                                8
+#define ES_Array_find                                                  9
+#define ES_Array_findAll                                               10
+#define ES_Array_forEach                                               11
+#define ES_Array_iterator_get                                          12
+#define ES_Array_iterator_getValues                                    13
+#define ES_Array_indexOf                                               14
+#define ES_Array_insert                                                15
+#define ES_Array_join                                                  16
+#define ES_Array_lastIndexOf                                           17
+#define ES_Array_length                                                18
+#define ES_Array_map                                                   19
+#define ES_Array_pop                                                   20
+#define ES_Array_push                                                  21
+#define ES_Array_reduce                                                22
+#define ES_Array_reduceRight                                           23
+#define ES_Array_reject                                                24
+#define ES_Array_remove                                                25
+#define ES_Array_removeElements                                        26
+#define ES_Array_reverse                                               27
+#define ES_Array_shift                                                 28
+#define ES_Array_slice                                                 29
+#define ES_Array_some                                                  30
+#define ES_Array_sort                                                  31
+#define ES_Array_splice                                                32
+#define ES_Array_toString                                              33
+#define ES_Array_transform                                             34
+#define ES_Array_unique                                                35
+#define ES_Array_unshift                                               36
+#define ES_Array_NUM_INSTANCE_PROP                                     37
 #define ES_Array_NUM_INHERITED_PROP                                    0
 
 
@@ -738,7 +791,8 @@
 #define ES_Cmd_timeout                                                 19
 #define ES_Cmd_wait                                                    20
 #define ES_Cmd_write                                                   21
-#define ES_Cmd_NUM_INSTANCE_PROP                                       22
+#define ES_Cmd_usage                                                   22
+#define ES_Cmd_NUM_INSTANCE_PROP                                       23
 #define ES_Cmd_NUM_INHERITED_PROP                                      0
 
 /*
@@ -2042,7 +2096,10 @@
 #define ES_Path_write                                                  78
 #define ES_Path_makeTemp                                               79
 #define ES_Path_compact                                                80
-#define ES_Path_NUM_INSTANCE_PROP                                      81
+#define ES_Path_copyList                                               81
+#define ES_Path_operateCopy                                            82
+#define ES_Path_linkModified                                           83
+#define ES_Path_NUM_INSTANCE_PROP                                      84
 #define ES_Path_NUM_INHERITED_PROP                                     0
 
 
@@ -2608,7 +2665,7 @@
 #define ES_XMLList_NUM_INSTANCE_PROP                                   20
 #define ES_XMLList_NUM_INHERITED_PROP                                  0
 
-#define _ES_CHECKSUM_ejs   1547263
+#define _ES_CHECKSUM_ejs   1559070
 
 #endif
 
@@ -3286,6 +3343,7 @@
  */
 #define ES_ejs_zlib_Zlib_compress_src                                  0
 #define ES_ejs_zlib_Zlib_compress_dest                                 1
+#define ES_ejs_zlib_Zlib_compress_options                              2
 #define ES_ejs_zlib_Zlib_uncompress_src                                0
 #define ES_ejs_zlib_Zlib_uncompress_dest                               1
 #define ES_ejs_zlib_Zlib_compressBytes_data                            0
@@ -3293,7 +3351,30 @@
 #define ES_ejs_zlib_Zlib_compressString_data                           0
 #define ES_ejs_zlib_Zlib_uncompressString_data                         0
 
-#define _ES_CHECKSUM_ejs_zlib   14504
+
+/*
+    Class property slots for the "GzipStream" type 
+ */
+#define ES_ejs_zlib_GzipStream_NUM_CLASS_PROP                          0
+
+/*
+   Prototype (instance) slots for "GzipStream" type 
+ */
+#define ES_ejs_zlib_GzipStream_write                                   0
+#define ES_ejs_zlib_GzipStream_close                                   1
+#define ES_ejs_zlib_GzipStream_md5                                     2
+#define ES_ejs_zlib_GzipStream_sha256                                  3
+#define ES_ejs_zlib_GzipStream_NUM_INSTANCE_PROP                       4
+#define ES_ejs_zlib_GzipStream_NUM_INHERITED_PROP                      0
+
+/*
+    Local slots for methods in type "GzipStream" 
+ */
+#define ES_ejs_zlib_GzipStream_GzipStream_path                         0
+#define ES_ejs_zlib_GzipStream_GzipStream_options                      1
+#define ES_ejs_zlib_GzipStream_write_data                              0
+
+#define _ES_CHECKSUM_ejs_zlib   20473
 
 #endif
 
@@ -26611,6 +26611,8 @@ PUBLIC void ejsConfigureAppType(Ejs *ejs)
 
 static int  checkSlot(Ejs *ejs, EjsArray *ap, int slotNum);
 static bool compareArrayElement(Ejs *ejs, EjsObj *v1, EjsObj *v2);
+static MprHash *createArrayIndex(Ejs *ejs, EjsArray *ap, int size);
+static cchar *getArrayElementKey(Ejs *ejs, EjsObj *vp);
 static int growArray(Ejs *ejs, EjsArray *ap, int len);
 static int lookupArrayProperty(Ejs *ejs, EjsArray *ap, EjsName qname);
 static EjsNumber *pushArray(Ejs *ejs, EjsArray *ap, int argc, EjsAny **argv);
@@ -26926,6 +26928,7 @@ static int setArrayProperty(Ejs *ejs, EjsArray *ap, int slotNum, EjsAny *value)
         return EJS_ERR;
     }
     ap->data[slotNum] = value;
+    ap->index = 0;
     return slotNum;
 }
 
@@ -26959,6 +26962,7 @@ static int setArrayPropertyByName(Ejs *ejs, EjsArray *ap, EjsName qname, EjsObj
         return EJS_ERR;
     }
     ap->data[slotNum] = value;
+    ap->index = 0;
     return slotNum;
 }
 
@@ -27048,6 +27052,7 @@ PUBLIC EjsArray *ejsRemoveItems(Ejs *ejs, EjsArray *lhs, EjsArray *rhs)
             }
         }
     }
+    lhs->index = 0;
     return lhs;
 }
 
@@ -27146,6 +27151,49 @@ static EjsArray *appendArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
 }
 
 
+/*
+    Append the elements of an array that are not already in the array. Elements are hashed so this is linear.
+    The index is kept with the array so repeated appends only hash the new items. Other changes clear the index.
+
+    function appendUnique(items: Array) : Array
+ */
+static EjsArray *appendUniqueArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
+{
+    EjsArray    *items;
+    MprHash     *index;
+    cchar       *key;
+    int         i, length;
+
+    assert(argc == 1 && ejsIs(ejs, argv[0], Array));
+
+    items = (EjsArray*) argv[0];
+    length = items->length;
+    if (length <= 0) {
+        return ap;
+    }
+    /*
+        Reuse the cached index unless it has too few buckets for the result. Rebuild with room to grow.
+     */
+    if ((index = ap->index) == 0 || index->size < (ap->length + length)) {
+        if ((index = createArrayIndex(ejs, ap, (ap->length + length) * 2)) == 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+    }
+    for (i = 0; i < length; i++) {
+        key = getArrayElementKey(ejs, items->data[i]);
+        if (!mprLookupKey(index, key)) {
+            mprAddKey(index, key, "");
+            if (setArrayProperty(ejs, ap, ap->length, items->data[i]) < 0) {
+                return 0;
+            }
+        }
+    }
+    ap->index = index;
+    return ap;
+}
+
+
 /*
     Clear an array. Remove all elements of the array.
 
@@ -27154,6 +27202,7 @@ static EjsArray *appendArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
 static EjsObj *clearArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
 {
     ap->length = 0;
+    ap->index = 0;
     return 0;
 }
 
@@ -27194,6 +27243,7 @@ static EjsArray *compactArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
     }
     oldLen = ap->length;
     ap->length = (int) (dest - &data[0]);
+    ap->index = 0;
     for (i = ap->length; i < oldLen; i++) {
         *dest++ = ESV(undefined);
     }
@@ -27406,6 +27456,45 @@ static bool compareArrayElement(Ejs *ejs, EjsObj *v1, EjsObj *v2)
 }
 
 
+/*
+    Return a hash key for an array element. Elements with equal keys are equal according to compareArrayElement.
+ */
+static cchar *getArrayElementKey(Ejs *ejs, EjsObj *vp)
+{
+    double      value;
+
+    if (ejsIs(ejs, vp, Number)) {
+        value = (double) ((EjsNumber*) vp)->value;
+        return sfmt("n%.17g", (value == 0) ? 0.0 : value);
+    }
+    if (ejsIs(ejs, vp, Path)) {
+        return sfmt("p%s", ((EjsPath*) vp)->value);
+    }
+    /* Strings are interned so they compare by reference */
+    return sfmt("o%p", vp);
+}
+
+
+/*
+    Create a hash index of the elements of an array
+ */
+static MprHash *createArrayIndex(Ejs *ejs, EjsArray *ap, int size)
+{
+    MprHash     *index;
+    int         i;
+
+    if ((index = mprCreateHash(size, MPR_HASH_MANAGED_KEYS | MPR_HASH_STATIC_VALUES | MPR_HASH_STABLE)) == 0) {
+        return 0;
+    }
+    if (ap) {
+        for (i = 0; i < ap->length; i++) {
+            mprAddKey(index, getArrayElementKey(ejs, ap->data[i]), "");
+        }
+    }
+    return index;
+}
+
+
 /*
     Search for an item using strict equality "===". This call searches from
     the start of the array for the specified element.
@@ -27646,6 +27735,7 @@ static EjsObj *setArrayLength(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
         }
     }
     ap->length = length;
+    ap->index = 0;
     return 0;
 }
 
@@ -27661,6 +27751,7 @@ static EjsObj *popArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
     if (ap->length == 0) {
         return ESV(undefined);
     }
+    ap->index = 0;
     return ap->data[--ap->length];
 }
 
@@ -27751,6 +27842,7 @@ static EjsObj *shiftArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
         data[i - 1] = data[i];
     }
     ap->length--;
+    ap->index = 0;
     return result;
 }
 
@@ -27984,6 +28076,7 @@ static EjsArray *spliceArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
     }
     oldLen = ap->length;
     delta = values->length - deleteCount;
+    ap->index = 0;
     
     if (delta > 0) {
         /*
@@ -28081,21 +28174,27 @@ static EjsString *arrayToString(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
 static EjsArray *uniqueArray(Ejs *ejs, EjsArray *ap, int argc, EjsObj **argv)
 {
     EjsObj      **data;
-    int     i, j, k;
+    MprHash     *index;
+    cchar       *key;
+    int         i, j;
 
+    if (ap->length <= 1) {
+        return ap;
+    }
+    if ((index = createArrayIndex(ejs, 0, ap->length)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
     data = ap->data;
-
-    for (i = 0; i < ap->length; i++) {
-        for (j = i + 1; j < ap->length; j++) {
-            if (compareArrayElement(ejs, data[i], data[j])) {
-                for (k = j + 1; k < ap->length; k++) {
-                    data[k - 1] = data[k];
-                }
-                ap->length--;
-                j--;
-            }
+    for (i = j = 0; i < ap->length; i++) {
+        key = getArrayElementKey(ejs, data[i]);
+        if (!mprLookupKey(index, key)) {
+            mprAddKey(index, key, "");
+            data[j++] = data[i];
         }
     }
+    ap->length = j;
+    ap->index = index;
     return ap;
 }
 
@@ -28142,6 +28241,7 @@ static int growArray(Ejs *ejs, EjsArray *ap, int len)
 
     assert(ap);
 
+    ap->index = 0;
     if (len <= 0) {
         return 0;
     }
@@ -28220,6 +28320,7 @@ PUBLIC int ejsAppendArray(Ejs *ejs, EjsArray *dest, EjsArray *src)
 PUBLIC void ejsClearArray(Ejs *ejs, EjsArray *ap)
 {
     ap->length = 0;
+    ap->index = 0;
 }
 
 
@@ -28408,6 +28509,7 @@ static void manageArray(EjsArray *ap, int flags)
             }
         }
         mprMark(data);
+        mprMark(ap->index);
         ejsManagePot((EjsPot*) ap, flags);
     }
 }
@@ -28455,6 +28557,7 @@ PUBLIC void ejsConfigureArrayType(Ejs *ejs)
     ejsBindMethod(ejs, prototype, ES_Array_clone, cloneArrayMethod);
     ejsBindMethod(ejs, prototype, ES_Array_toString, arrayToString);
     ejsBindMethod(ejs, prototype, ES_Array_append, appendArray);
+    ejsBindMethod(ejs, prototype, ES_Array_appendUnique, appendUniqueArray);
     ejsBindMethod(ejs, prototype, ES_Array_clear, clearArray);
     ejsBindMethod(ejs, prototype, ES_Array_compact, compactArray);
     ejsBindMethod(ejs, prototype, ES_Array_concat, concatArray);
@@ -31092,6 +31195,26 @@ static EjsNumber *cmd_status(Ejs *ejs, EjsCmd *cmd, int argc, EjsObj **argv)
 }
 
 
+/**
+    function get usage(): Object?
+ */
+static EjsObj *cmd_usage(Ejs *ejs, EjsCmd *cmd, int argc, EjsObj **argv)
+{
+    EjsObj      *result;
+    MprTicks    userTime, sysTime;
+    int64       maxRss;
+
+    if (cmd->mc == 0 || mprGetCmdUsage(cmd->mc, &userTime, &sysTime, &maxRss) < 0) {
+        return ESV(null);
+    }
+    result = (EjsObj*) ejsCreateEmptyPot(ejs);
+    ejsSetPropertyByName(ejs, result, EN("user"), ejsCreateNumber(ejs, (MprNumber) userTime));
+    ejsSetPropertyByName(ejs, result, EN("sys"), ejsCreateNumber(ejs, (MprNumber) sysTime));
+    ejsSetPropertyByName(ejs, result, EN("rss"), ejsCreateNumber(ejs, (MprNumber) maxRss));
+    return result;
+}
+
+
 /**
     function stop(signal: Number = 2): Boolean
  */
@@ -31283,6 +31406,7 @@ PUBLIC void ejsConfigureCmdType(Ejs *ejs)
 
     ejsBindMethod(ejs, prototype, ES_Cmd_wait, cmd_wait);
     ejsBindMethod(ejs, prototype, ES_Cmd_write, cmd_write);
+    ejsBindAccess(ejs, prototype, ES_Cmd_usage, cmd_usage, 0);
 }
 
 
@@ -33189,13 +33313,12 @@ static EjsObj *setFilePosition(Ejs *ejs, EjsFile *fp, int argc, EjsObj **argv)
     MprOff      pos;
 
     assert(argc == 1 && ejsIs(ejs, argv[0], Number));
-    pos = ejsGetInt(ejs, argv[0]);
 
     if (fp->file == 0) {
         ejsThrowStateError(ejs, "File not opened");
         return 0;
     }
-    pos = ejsGetInt(ejs, argv[0]);
+    pos = (MprOff) ejsGetNumber(ejs, argv[0]);
     if (mprSeekFile(fp->file, SEEK_SET, pos) != pos) {
         ejsThrowIOError(ejs, "Cannot seek to %Ld", pos);
     }
@@ -33466,9 +33589,9 @@ static EjsObj *getFileSize(Ejs *ejs, EjsFile *fp, int argc, EjsObj **argv)
  */
 PUBLIC EjsObj *truncateFile(Ejs *ejs, EjsFile *fp, int argc, EjsObj **argv)
 {
-    int     size;
+    MprOff  size;
 
-    size = ejsGetInt(ejs, argv[0]);
+    size = (MprOff) ejsGetNumber(ejs, argv[0]);
     if (mprTruncateFile(fp->path, size) < 0) {
         ejsThrowIOError(ejs, "Cant truncate %s", fp->path);
     }
@@ -41861,6 +41984,114 @@ PUBLIC int ejsSetPathAttributes(Ejs *ejs, cchar *path, EjsObj *attributes)
 }
 
 
+/*
+    Modified times in nanoseconds. Only Linux supports sub-second times here, so other systems require the
+    destination to be strictly newer than the source.
+ */
+#if LINUX
+    #define EJS_MTIME(sp)       ((sp)->st_mtim.tv_sec * (int64) 1000000000 + (sp)->st_mtim.tv_nsec)
+    #define EJS_MTIME_EXACT     1
+#else
+    #define EJS_MTIME(sp)       ((int64) (sp)->st_mtime * 1000000000)
+    #define EJS_MTIME_EXACT     0
+#endif
+
+#define EJS_UPDATE_MTIME        1       /* Destination is current if the same size and newer than the source */
+#define EJS_UPDATE_CONTENTS     2       /* Destination is current if it has the same contents as the source */
+
+/*
+    Get the copy update mode from the "update" option. Set to true for size and time checks, or 'contents' to
+    compare file contents.
+ */
+static int getUpdateMode(Ejs *ejs, EjsObj *options)
+{
+    EjsObj  *vp;
+
+    if (options == 0 || (vp = ejsGetPropertyByName(ejs, options, EN("update"))) == 0) {
+        return 0;
+    }
+    if (ejsIs(ejs, vp, String) && ejsCompareAsc(ejs, (EjsString*) vp, "contents") == 0) {
+        return EJS_UPDATE_CONTENTS;
+    }
+    return (ejsToBoolean(ejs, vp) == ESV(true)) ? EJS_UPDATE_MTIME : 0;
+}
+
+
+static bool sameContents(cchar *fromPath, cchar *toPath, MprOff size)
+{
+    char    ibuf[ME_BUFSIZE], obuf[ME_BUFSIZE];
+    ssize   bytes;
+    int     ifd, ofd;
+    bool    same;
+
+    if ((ifd = open(fromPath, O_RDONLY | O_BINARY, 0)) < 0) {
+        return 0;
+    }
+    if ((ofd = open(toPath, O_RDONLY | O_BINARY, 0)) < 0) {
+        close(ifd);
+        return 0;
+    }
+    same = 1;
+    while (size > 0 && same) {
+        bytes = (ssize) min(size, (MprOff) sizeof(ibuf));
+        if (read(ifd, ibuf, (int) bytes) != bytes || read(ofd, obuf, (int) bytes) != bytes) {
+            same = 0;
+        } else {
+            same = memcmp(ibuf, obuf, bytes) == 0;
+            size -= bytes;
+        }
+    }
+    close(ifd);
+    close(ofd);
+    return same;
+}
+
+
+/*
+    Test if the destination is a current copy of the source and need not be copied. The destination is current if it
+    is the same size and newer than the source. If comparing contents, the destination is only current if it has the
+    same contents, regardless of modified times. An older destination then has its modified time set to that of the
+    source.
+    This does not allocate memory so it may be called from yielded worker threads.
+ */
+static bool isCurrentCopy(cchar *fromPath, cchar *toPath, int mode)
+{
+    struct stat     from, to;
+    int64           fromTime, toTime;
+
+    if (mode == 0 || stat(fromPath, &from) < 0 || stat(toPath, &to) < 0) {
+        return 0;
+    }
+    if (!S_ISREG(from.st_mode) || !S_ISREG(to.st_mode) || from.st_size != to.st_size) {
+        return 0;
+    }
+    fromTime = EJS_MTIME(&from);
+    toTime = EJS_MTIME(&to);
+    if (mode == EJS_UPDATE_MTIME) {
+        return toTime > fromTime || (EJS_MTIME_EXACT && toTime == fromTime);
+    }
+    if (!sameContents(fromPath, toPath, from.st_size)) {
+        return 0;
+    }
+    if (toTime < fromTime) {
+#if LINUX
+        struct timespec times[2];
+        times[0] = to.st_atim;
+        times[1] = from.st_mtim;
+        utimensat(AT_FDCWD, toPath, times, 0);
+#elif ME_UNIX_LIKE
+        struct timeval times[2];
+        times[0].tv_sec = to.st_atime;
+        times[0].tv_usec = 0;
+        times[1].tv_sec = from.st_mtime;
+        times[1].tv_usec = 0;
+        utimes(toPath, times);
+#endif
+    }
+    return 1;
+}
+
+
 /*
     Copy a file
     function copy(to: Object, options: Object = null): Void
@@ -41868,18 +42099,17 @@ PUBLIC int ejsSetPathAttributes(Ejs *ejs, cchar *path, EjsObj *attributes)
 static EjsObj *copyPath(Ejs *ejs, EjsPath *fp, int argc, EjsObj **argv)
 {
     MprFileSystem   *fs;
-    MprFile         *from, *to;
     MprPath         info;
     EjsObj          *options;
     cchar           *fromPath, *toPath;
-    ssize           bytes, len;
-    char            *buf, lastc;
+    ssize           len;
+    char            lastc;
+    int             rc;
 
     assert(argc >= 1);
     options = (argc >= 2) ? argv[1] : 0;
     fromPath = fp->value;
 
-    from = to = 0;
     if ((toPath = getPathString(ejs, argv[0])) == 0) {
         return 0;
     }
@@ -41891,13 +42121,17 @@ static EjsObj *copyPath(Ejs *ejs, EjsPath *fp, int argc, EjsObj **argv)
     if (mprIsPathDir(toPath) || (lastc == fs->separators[0] || lastc == fs->separators[1])) {
         toPath = mprJoinPath(toPath, mprGetPathBase(fromPath));
     }
-    if ((from = mprOpenFile(fromPath, O_RDONLY | O_BINARY, 0)) == 0) {
-        ejsThrowIOError(ejs, "Cannot open %s", fromPath);
+    if (isCurrentCopy(fromPath, toPath, getUpdateMode(ejs, options))) {
         return 0;
     }
-    if ((to = mprOpenFile(toPath, O_CREAT | O_WRONLY | O_TRUNC | O_BINARY, EJS_FILE_PERMS)) == 0) {
-        ejsThrowIOError(ejs, "Cannot create %s, errno %d", toPath, errno);
-        mprCloseFile(from);
+    if ((rc = mprCopyPath(fromPath, toPath, EJS_FILE_PERMS)) < 0) {
+        if (rc == MPR_ERR_CANT_OPEN) {
+            ejsThrowIOError(ejs, "Cannot open %s", fromPath);
+        } else if (rc == MPR_ERR_CANT_CREATE) {
+            ejsThrowIOError(ejs, "Cannot create %s, errno %d", toPath, errno);
+        } else {
+            ejsThrowIOError(ejs, "Write error to %s", toPath);
+        }
         return 0;
     }
     /* Keep perms of original file, don't inherit user/group (may not have permissions to create) */
@@ -41907,21 +42141,272 @@ static EjsObj *copyPath(Ejs *ejs, EjsPath *fp, int argc, EjsObj **argv)
     if (options) {
         ejsSetPathAttributes(ejs, toPath, options);
     }
-    if ((buf = mprAlloc(ME_MAX_BUFFER)) == NULL) {
+    return 0;
+}
+
+
+/*
+    Concurrent copy state shared by copy worker threads
+ */
+typedef struct CopyList {
+    MprList         *from;              /* Source filenames */
+    MprList         *to;                /* Destination filenames */
+    int             *status;            /* Per-file copy status */
+    int             next;               /* Index of the next file to copy */
+    int             update;             /* Skip destinations that are current (EJS_UPDATE_*) */
+    int             active;             /* Count of active workers */
+    MprMutex        *mutex;
+    MprCond         *cond;              /* Signalled when the last worker completes */
+} CopyList;
+
+#ifndef EJS_COPY_THREADS
+    #define EJS_COPY_THREADS 8
+#endif
+
+/*
+    Copy file contents and permissions. This does not allocate managed memory so it may be called from
+    yielded worker threads.
+ */
+static int copyFileData(cchar *fromPath, cchar *toPath)
+{
+    struct stat     sbuf;
+    int             rc;
+
+    if (stat(fromPath, &sbuf) < 0) {
+        return MPR_ERR_CANT_ACCESS;
+    }
+    if ((rc = mprCopyPath(fromPath, toPath, EJS_FILE_PERMS)) < 0) {
+        return rc;
+    }
+    /* Keep perms of original file, don't inherit user/group (may not have permissions to create) */
+    chmod(toPath, sbuf.st_mode & 07777);
+    return 0;
+}
+
+
+/*
+    Copy files until none remain. Worker threads do not allocate managed memory, so they yield to the garbage
+    collector for their lifetime. The calling thread is not yielded as the VM may only collect at its own safe points.
+ */
+static void copyWorker(CopyList *list, MprThread *tp)
+{
+    int     index;
+
+    if (tp) {
+        mprYield(MPR_YIELD_STICKY);
+    }
+    while (1) {
+        mprLock(list->mutex);
+        index = list->next++;
+        mprUnlock(list->mutex);
+        if (index >= list->from->length) {
+            break;
+        }
+        if (!isCurrentCopy(mprGetItem(list->from, index), mprGetItem(list->to, index), list->update)) {
+            list->status[index] = copyFileData(mprGetItem(list->from, index), mprGetItem(list->to, index));
+        }
+    }
+    mprLock(list->mutex);
+    if (--list->active == 0) {
+        mprSignalCond(list->cond);
+    }
+    mprUnlock(list->mutex);
+    if (tp) {
+        mprResetYield();
+    }
+}
+
+
+static void manageCopyList(CopyList *list, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(list->from);
+        mprMark(list->to);
+        mprMark(list->status);
+        mprMark(list->mutex);
+        mprMark(list->cond);
+    }
+}
+
+
+static CopyList *createCopyList(Ejs *ejs, int count, EjsObj *options)
+{
+    CopyList    *list;
+
+    if ((list = mprAllocObj(CopyList, manageCopyList)) == 0) {
         ejsThrowMemoryError(ejs);
-        mprCloseFile(to);
-        mprCloseFile(from);
         return 0;
     }
-    while ((bytes = mprReadFile(from, buf, ME_MAX_BUFFER)) > 0) {
-        if (mprWriteFile(to, buf, bytes) != bytes) {
-            ejsThrowIOError(ejs, "Write error to %s", toPath);
-            break;
+    list->from = mprCreateList(count, 0);
+    list->to = mprCreateList(count, 0);
+    list->mutex = mprCreateLock();
+    list->cond = mprCreateCond();
+    list->update = getUpdateMode(ejs, options);
+    return list;
+}
+
+
+/*
+    Copy the files in the list using worker threads and wait for completion
+ */
+static void runCopyList(Ejs *ejs, CopyList *list, EjsObj *options)
+{
+    MprThread   *tp;
+    EjsObj      *vp;
+    int         i, count, threads;
+
+    count = list->from->length;
+    list->status = mprAllocZeroed(sizeof(int) * max(count, 1));
+    threads = EJS_COPY_THREADS;
+    if (options && (vp = ejsGetPropertyByName(ejs, options, EN("threads"))) != 0 && ejsIs(ejs, vp, Number)) {
+        threads = max(ejsGetInt(ejs, vp), 1);
+    }
+    threads = min(threads, count);
+    list->next = 0;
+    list->active = threads;
+    mprAddRoot(list);
+    for (i = 0; i < threads; i++) {
+        if ((tp = mprCreateThread("copy", copyWorker, list, 0)) == 0 || mprStartThread(tp) < 0) {
+            /* Run the remaining share on this thread */
+            copyWorker(list, NULL);
         }
     }
-    mprCloseFile(from);
-    mprCloseFile(to);
-    return 0;
+    mprLock(list->mutex);
+    while (list->active > 0) {
+        mprUnlock(list->mutex);
+        mprWaitForCond(list->cond, -1);
+        mprLock(list->mutex);
+    }
+    mprUnlock(list->mutex);
+    mprRemoveRoot(list);
+}
+
+
+/*
+    Copy a list of files concurrently. Source files are relative to the path.
+    function copyList(from: Array, to: Array, options: Object? = null): Array
+ */
+static EjsArray *copyPathList(Ejs *ejs, EjsPath *fp, int argc, EjsObj **argv)
+{
+    CopyList    *list;
+    EjsArray    *from, *to, *failed;
+    EjsObj      *options;
+    int         i, count;
+
+    from = (EjsArray*) argv[0];
+    to = (EjsArray*) argv[1];
+    options = (argc >= 3 && ejsIsDefined(ejs, argv[2])) ? argv[2] : 0;
+    count = min(from->length, to->length);
+    if ((list = createCopyList(ejs, count, options)) == 0) {
+        return 0;
+    }
+    for (i = 0; i < count; i++) {
+        mprAddItem(list->from, mprJoinPath(fp->value, getPathString(ejs, ejsGetProperty(ejs, from, i))));
+        mprAddItem(list->to, getPathString(ejs, ejsGetProperty(ejs, to, i)));
+    }
+    runCopyList(ejs, list, options);
+
+    failed = ejsCreateArray(ejs, 0);
+    for (i = 0; i < count; i++) {
+        if (list->status[i] < 0) {
+            ejsAddItem(ejs, failed, ejsCreateNumber(ejs, i));
+        } else if (options) {
+            ejsSetPathAttributes(ejs, mprGetItem(list->to, i), options);
+        }
+    }
+    return failed;
+}
+
+
+/*
+    Copy files for Path.operate without calling back into script. Source files are relative to the path.
+    Destinations are created under the "to" directory, flattened if requested, or the files are copied to "to".
+    Sources already in the hash are skipped and new sources are added to it. Returns the count of files and
+    directories processed.
+
+    function operateCopy(files: Array, to: Path, toDir: Boolean, options: Object, hash: Object? = null): Number
+ */
+static EjsNumber *operateCopy(Ejs *ejs, EjsPath *fp, int argc, EjsObj **argv)
+{
+    CopyList    *list;
+    MprHash     *made;
+    EjsArray    *files;
+    EjsObj      *options, *hash;
+    cchar       *to, *name, *src, *dest, *dir;
+    int         i, count, toDir, flatten, isDir;
+
+    files = (EjsArray*) argv[0];
+    if ((to = getPathString(ejs, argv[1])) == 0) {
+        return 0;
+    }
+    toDir = (argv[2] == ESV(true));
+    options = ejsIsDefined(ejs, argv[3]) ? argv[3] : 0;
+    hash = (argc >= 5 && ejsIsDefined(ejs, argv[4])) ? argv[4] : 0;
+    flatten = options && ejsGetPropertyByName(ejs, options, EN("flatten")) == ESV(true);
+
+    if ((list = createCopyList(ejs, files->length, options)) == 0) {
+        return 0;
+    }
+    made = mprCreateHash(0, MPR_HASH_STATIC_VALUES);
+    count = 0;
+
+    for (i = 0; i < files->length; i++) {
+        if ((name = getPathString(ejs, ejsGetProperty(ejs, files, i))) == 0) {
+            return 0;
+        }
+        src = mprJoinPath(fp->value, name);
+        isDir = mprIsPathDir(src);
+        if (isDir && flatten) {
+            continue;
+        }
+        if (!toDir) {
+            dest = to;
+        } else if (flatten) {
+            dest = mprJoinPath(to, mprGetPathBase(name));
+        } else if (mprIsPathAbs(name)) {
+            /* Can happen if the from pattern is absolute */
+            dest = sjoin(to, name, NULL);
+        } else {
+            dest = mprJoinPath(to, name);
+        }
+        if (hash) {
+            if (ejsGetPropertyByName(ejs, hash, EN(src)) != 0) {
+                continue;
+            }
+        }
+        if (mprSamePath(src, dest)) {
+            mprPrintf("WARNING: src same as dest for %s\n", src);
+            continue;
+        }
+        if (hash) {
+            ejsSetPropertyByName(ejs, hash, EN(src), ESV(true));
+        }
+        count++;
+        if (isDir) {
+            mprMakeDir(dest, 0755, -1, -1, 1);
+            continue;
+        }
+        dir = mprGetPathDir(dest);
+        if (!mprLookupKey(made, dir)) {
+            mprMakeDir(dir, 0755, -1, -1, 1);
+            mprAddKey(made, dir, "");
+        }
+        mprAddItem(list->from, src);
+        mprAddItem(list->to, dest);
+    }
+    runCopyList(ejs, list, options);
+
+    for (i = 0; i < list->from->length; i++) {
+        dest = mprGetItem(list->to, i);
+        if (list->status[i] < 0) {
+            ejsThrowIOError(ejs, "Cannot copy %s to %s", (char*) mprGetItem(list->from, i), dest);
+            return 0;
+        }
+        if (options) {
+            ejsSetPathAttributes(ejs, dest, options);
+        }
+    }
+    return ejsCreateNumber(ejs, count);
 }
 
 
@@ -42775,6 +43260,26 @@ static EjsDate *getModifiedDate(Ejs *ejs, EjsPath *fp, int argc, EjsObj **argv)
 }
 
 
+/*
+    Get when the path itself was last modified without following symbolic links.
+  
+    function get linkModified(): Date
+ */
+static EjsDate *getLinkModifiedDate(Ejs *ejs, EjsPath *fp, int argc, EjsObj **argv)
+{
+#if ME_UNIX_LIKE
+    struct stat     s;
+
+    if (lstat(fp->value, &s) < 0) {
+        return ESV(null);
+    }
+    return ejsCreateDate(ejs, ((MprTime) s.st_mtime) * 1000);
+#else
+    return getModifiedDate(ejs, fp, argc, argv);
+#endif
+}
+
+
 /*
     function get name(): String
  */
@@ -43422,6 +43927,9 @@ PUBLIC void ejsConfigurePathType(Ejs *ejs)
     ejsBindMethod(ejs, prototype, ES_Path_basename, getPathBasename);
     ejsBindMethod(ejs, prototype, ES_Path_components, getPathComponents);
     ejsBindMethod(ejs, prototype, ES_Path_copy, copyPath);
+    ejsBindMethod(ejs, prototype, ES_Path_copyList, copyPathList);
+    ejsBindMethod(ejs, prototype, ES_Path_operateCopy, operateCopy);
+    ejsBindAccess(ejs, prototype, ES_Path_linkModified, getLinkModifiedDate, NULL);
     ejsBindMethod(ejs, prototype, ES_Path_created, getCreatedDate);
     ejsBindMethod(ejs, prototype, ES_Path_dirname, getPathDirname);
     ejsBindMethod(ejs, prototype, ES_Path_exists, getPathExists);
@@ -45050,6 +45558,8 @@ PUBLIC void ejsConfigureRegExpType(Ejs *ejs)
 /*********************************** Forwards *********************************/
 
 static void enableSocketEvents(EjsSocket *sp, int (*proc)(EjsSocket *sp, MprEvent *event));
+static char *getSocketPath(Ejs *ejs, EjsObj *address);
+static bool isSocketPath(Ejs *ejs, EjsObj *address);
 static int socketIOEvent(EjsSocket *sp, MprEvent *event);
 static int socketListenEvent(EjsSocket *listen, MprEvent *event);
 
@@ -45146,6 +45656,9 @@ static EjsObj *sock_connect(Ejs *ejs, EjsSocket *sp, int argc, EjsObj **argv)
     if (ejsIs(ejs, address, Number)) {
         sp->address = sclone("127.0.0.1");
         sp->port = (int) ((EjsNumber*) address)->value;
+    } else if (isSocketPath(ejs, (EjsObj*) address)) {
+        sp->address = getSocketPath(ejs, (EjsObj*) address);
+        sp->port = 0;
     } else {
         if (!ejsIs(ejs, address, String)) {
             address = ejsToString(ejs, address);
@@ -45200,6 +45713,9 @@ static EjsObj *sock_listen(Ejs *ejs, EjsSocket *sp, int argc, EjsObj **argv)
     if (ejsIs(ejs, address, Number)) {
         sp->address = sclone("");
         sp->port = (int) ((EjsNumber*) address)->value;
+    } else if (isSocketPath(ejs, (EjsObj*) address)) {
+        sp->address = getSocketPath(ejs, (EjsObj*) address);
+        sp->port = 0;
     } else {
         if (!ejsIs(ejs, address, String)) {
             address = ejsToString(ejs, address);
@@ -45367,6 +45883,32 @@ static EjsNumber *sock_write(Ejs *ejs, EjsSocket *sp, int argc, EjsObj **argv)
 
 /*********************************** Support **********************************/
 
+/*
+    Test if an address is a Path or an absolute path string. These select a Unix domain socket.
+ */
+static bool isSocketPath(Ejs *ejs, EjsObj *address)
+{
+#if ME_UNIX_LIKE
+    if (ejsIs(ejs, address, Path)) {
+        return 1;
+    }
+    if (ejsIs(ejs, address, String)) {
+        return ((EjsString*) address)->value[0] == '/';
+    }
+#endif
+    return 0;
+}
+
+
+static char *getSocketPath(Ejs *ejs, EjsObj *address)
+{
+    if (ejsIs(ejs, address, Path)) {
+        return mprGetAbsPath(((EjsPath*) address)->value);
+    }
+    return ejsToMulti(ejs, address);
+}
+
+
 static void enableSocketEvents(EjsSocket *sp, int (*proc)(EjsSocket *sp, MprEvent *event))
 {
     Ejs     *ejs;
@@ -55757,6 +56299,229 @@ PUBLIC int ejs_db_sqlite_Init(Ejs *ejs, MprModule *mp)
  */
 
 
+/********* Start of file ../../../src/ejs.digest/ejsDigest.c ************/
+
+/*
+    ejsDigest.c -- Incremental message digests
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+/********************************** Includes **********************************/
+
+
+
+/*********************************** Locals ***********************************/
+
+#define DIGEST_BUFSIZE (64 * 1024)
+
+/*
+    Ejscript Digest class object
+ */
+typedef struct EjsDigest {
+    EjsPot          pot;            /* Extends Object */
+    MprDigest       *dp;            /* MPR digest state */
+    cchar           *result;        /* Finalized digest */
+} EjsDigest;
+
+/************************************ Code ************************************/
+/*
+    function Digest(algorithm: String = 'sha256')
+ */
+static EjsDigest *digestConstructor(Ejs *ejs, EjsDigest *dg, int argc, EjsObj **argv)
+{
+    cchar   *algorithm;
+    int     type;
+
+    algorithm = (argc >= 1) ? ejsToMulti(ejs, argv[0]) : "sha256";
+    if (smatch(algorithm, "md5")) {
+        type = MPR_DIGEST_MD5;
+    } else if (smatch(algorithm, "sha1")) {
+        type = MPR_DIGEST_SHA1;
+    } else if (smatch(algorithm, "sha256")) {
+        type = MPR_DIGEST_SHA256;
+    } else {
+        ejsThrowArgError(ejs, "Unsupported digest algorithm \"%s\"", algorithm);
+        return 0;
+    }
+    if ((dg->dp = mprCreateDigest(type)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    return dg;
+}
+
+
+static bool digestActive(Ejs *ejs, EjsDigest *dg)
+{
+    if (dg->result) {
+        ejsThrowStateError(ejs, "Digest has been finalized");
+        return 0;
+    }
+    return 1;
+}
+
+
+/*
+    function update(...data): Digest
+ */
+static EjsDigest *digestUpdate(Ejs *ejs, EjsDigest *dg, int argc, EjsObj **argv)
+{
+    EjsArray        *args;
+    EjsByteArray    *ap;
+    EjsObj          *vp;
+    cchar           *buf;
+    int             i;
+
+    assert(argc == 1 && ejsIs(ejs, argv[0], Array));
+    args = (EjsArray*) argv[0];
+
+    if (!digestActive(ejs, dg)) {
+        return 0;
+    }
+    for (i = 0; i < args->length; i++) {
+        vp = ejsGetProperty(ejs, (EjsObj*) args, i);
+        if (ejsIs(ejs, vp, ByteArray)) {
+            ap = (EjsByteArray*) vp;
+            mprUpdateDigest(dg->dp, &ap->value[ap->readPosition], ap->writePosition - ap->readPosition);
+        } else {
+            buf = ejsToMulti(ejs, vp);
+            mprUpdateDigest(dg->dp, buf, slen(buf));
+        }
+    }
+    return dg;
+}
+
+
+/*
+    function updateFile(file: Object): Digest
+ */
+static EjsDigest *digestUpdateFile(Ejs *ejs, EjsDigest *dg, int argc, EjsObj **argv)
+{
+#if ME_MPR_MAP_FILES
+    MprFileMap  *map;
+#endif
+    MprFile     *file;
+    cchar       *path;
+    char        *buf;
+    ssize       nbytes;
+
+    if (!digestActive(ejs, dg)) {
+        return 0;
+    }
+    if (ejsIs(ejs, argv[0], File)) {
+        if ((file = ((EjsFile*) argv[0])->file) == 0) {
+            ejsThrowStateError(ejs, "File not open");
+            return 0;
+        }
+        path = ((EjsFile*) argv[0])->path;
+    } else {
+        path = ejsToMulti(ejs, argv[0]);
+#if ME_MPR_MAP_FILES
+        /*
+            Digest the mapped file without copying
+         */
+        if ((map = mprMapFile(path, MPR_MAP_SEQUENTIAL)) == 0) {
+            ejsThrowIOError(ejs, "Cannot read %s", path);
+            return 0;
+        }
+        mprUpdateDigest(dg->dp, map->data, (ssize) map->size);
+        mprUnmapFile(map);
+        return dg;
+#else
+        if ((file = mprOpenFile(path, O_RDONLY | O_BINARY, 0)) == 0) {
+            ejsThrowIOError(ejs, "Cannot open %s", path);
+            return 0;
+        }
+#endif
+    }
+    if ((buf = mprAlloc(DIGEST_BUFSIZE)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    while ((nbytes = mprReadFile(file, buf, DIGEST_BUFSIZE)) > 0) {
+        mprUpdateDigest(dg->dp, buf, nbytes);
+    }
+    if (!ejsIs(ejs, argv[0], File)) {
+        mprCloseFile(file);
+    }
+    if (nbytes < 0) {
+        ejsThrowIOError(ejs, "Cannot read %s", path);
+        return 0;
+    }
+    return dg;
+}
+
+
+/*
+    function digest(): String
+ */
+static EjsString *digestFinalize(Ejs *ejs, EjsDigest *dg, int argc, EjsObj **argv)
+{
+    if (!dg->result) {
+        dg->result = mprFinalizeDigest(dg->dp);
+    }
+    return ejsCreateStringFromAsc(ejs, dg->result);
+}
+
+/*********************************** Factory **********************************/
+
+static void manageDigest(EjsDigest *dg, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        ejsManagePot(dg, flags);
+        mprMark(dg->dp);
+        mprMark(dg->result);
+    }
+}
+
+
+static int configureDigestTypes(Ejs *ejs)
+{
+    EjsType     *type;
+    EjsPot      *prototype;
+
+    if ((type = ejsFinalizeScriptType(ejs, N("ejs.digest", "Digest"), sizeof(EjsDigest), manageDigest,
+            EJS_TYPE_POT)) == 0) {
+        return 0;
+    }
+    prototype = type->prototype;
+    ejsBindConstructor(ejs, type, digestConstructor);
+    ejsBindMethod(ejs, prototype, ES_ejs_digest_Digest_update, digestUpdate);
+    ejsBindMethod(ejs, prototype, ES_ejs_digest_Digest_updateFile, digestUpdateFile);
+    ejsBindMethod(ejs, prototype, ES_ejs_digest_Digest_digest, digestFinalize);
+    return 0;
+}
+
+
+/*
+    Module load entry point. This must be idempotent as it will be called for each new interpreter created.
+ */
+PUBLIC int ejs_digest_Init(Ejs *ejs, MprModule *mp)
+{
+    return ejsAddNativeModule(ejs, "ejs.digest", configureDigestTypes, _ES_CHECKSUM_ejs_digest, EJS_LOADER_ETERNAL);
+}
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a 
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
+
+
 /********* Start of file ../../../src/ejs.web/ejsHttpServer.c ************/
 
 /*
@@ -58731,20 +59496,82 @@ int ejs_web_Init(Ejs *ejs, MprModule *mp)
 
 #define     ZBUFSIZE (16 * 1024)
 
+/*
+    Parallel compression block size and the dictionary carried from the previous block
+ */
+#define     GZIP_BLOCK      (128 * 1024)
+#define     GZIP_DICT       (32 * 1024)
+
+/*
+    Block of data compressed independently by a worker thread
+ */
+typedef struct GzipBlock {
+    z_stream        zs;             /* Raw deflate state for this block */
+    uchar           *in;            /* Uncompressed data */
+    uchar           *out;           /* Compressed data */
+    cuchar          *dict;          /* Preset dictionary from the previous block */
+    ssize           inLen;          /* Length of uncompressed data */
+    ssize           outLen;         /* Length of compressed data */
+    ssize           outSize;        /* Size of the out buffer */
+    ssize           dictLen;        /* Length of the dictionary */
+    uLong           crc;            /* CRC-32 of the uncompressed data */
+    int             active;         /* Deflate state is initialized */
+    int             last;           /* Final block in the stream */
+    int             status;         /* Compression status */
+} GzipBlock;
+
+/*
+    Streaming gzip compressor
+ */
+typedef struct EjsGzipStream {
+    EjsPot          pot;            /* Extends Object */
+    cchar           *path;          /* Destination filename */
+    MprFile         *file;          /* Destination file */
+    MprDigest       *md5;           /* MD5 digest of the compressed output */
+    MprDigest       *sha256;        /* SHA-256 digest of the compressed output */
+    cchar           *md5sum;        /* Finalized MD5 digest */
+    cchar           *sha256sum;     /* Finalized SHA-256 digest */
+    z_stream        zs;             /* Deflate state */
+    int             active;         /* Deflate state is initialized */
+    int             level;          /* Compression level */
+
+    /*
+        Parallel compression. Input is split into blocks that are compressed concurrently and concatenated.
+     */
+    int             threads;        /* Number of blocks compressed concurrently. Zero for serial compression. */
+    GzipBlock       *blocks;        /* Blocks for each thread */
+    int             count;          /* Number of full blocks awaiting compression */
+    int             next;           /* Next block for a worker to compress */
+    int             running;        /* Count of running workers */
+    uchar           *dict;          /* Tail of the last compressed block */
+    ssize           dictLen;        /* Length of dict */
+    uLong           crc;            /* CRC-32 of all uncompressed data */
+    uint64          size;           /* Total uncompressed length */
+    MprMutex        *mutex;
+    MprCond         *cond;          /* Signalled when the last worker completes */
+} EjsGzipStream;
+
+static EjsGzipStream *gzipConstructor(Ejs *ejs, EjsGzipStream *gz, int argc, EjsObj **argv);
+static EjsObj *gzipClose(Ejs *ejs, EjsGzipStream *gz, int argc, EjsObj **argv);
+static int gzipData(Ejs *ejs, EjsGzipStream *gz, cchar *buf, ssize len);
+
 /************************************ Code ************************************/
 /*
-    compress(src: Path, dest: Path = null)
+    Compress a file using a GzipStream
+    compress(src: Path, dest: Path = null, options: Object = null)
  */
 static EjsObj *zlib_compress(Ejs *ejs, EjsObj *unused, int argc, EjsObj **argv)
 {
-    MprFile     *in;
-    gzFile      out;
-    cchar       *src, *dest;
-    uchar       inbuf[ME_MAX_BUFFER];
-    ssize       nbytes;
+    EjsGzipStream   *gz;
+    EjsType         *type;
+    EjsObj          *args[2];
+    MprFile         *in;
+    cchar           *src, *dest;
+    uchar           inbuf[ME_MAX_BUFFER];
+    ssize           nbytes;
 
     src = ((EjsPath*) argv[0])->value;
-    dest = (argc >= 2) ? ejsToMulti(ejs, argv[1]) : 0;
+    dest = (argc >= 2 && ejsIsDefined(ejs, argv[1])) ? ejsToMulti(ejs, argv[1]) : 0;
     if (!dest) {
         dest = sjoin(src, ".gz", NULL);
     }
@@ -58752,24 +59579,36 @@ static EjsObj *zlib_compress(Ejs *ejs, EjsObj *unused, int argc, EjsObj **argv)
         ejsThrowIOError(ejs, "Cannot open from %s", src);
         return 0;
     }
-    if ((out = gzopen(dest, "wb")) == 0) {
-        ejsThrowIOError(ejs, "Cannot open destination %s", dest);
+    type = ejsGetTypeByName(ejs, N("ejs.zlib", "GzipStream"));
+    if ((gz = ejsCreateObj(ejs, type, 0)) == 0) {
+        mprCloseFile(in);
+        return 0;
+    }
+    args[0] = (EjsObj*) ejsCreatePathFromAsc(ejs, dest);
+    args[1] = (argc >= 3) ? argv[2] : ESV(null);
+    mprAddRoot(gz);
+    mprAddRoot(in);
+    if (gzipConstructor(ejs, gz, 2, args) == 0) {
+        mprCloseFile(in);
+        mprRemoveRoot(in);
+        mprRemoveRoot(gz);
         return 0;
     }
     while (1) {
         if ((nbytes = mprReadFile(in, inbuf, sizeof(inbuf))) < 0) {
             ejsThrowIOError(ejs, "Cannot read from %s", src);
-            return 0;
+            break;
         } else if (nbytes == 0) {
             break;
         }
-        if (gzwrite(out, inbuf, (int) nbytes) != nbytes) {
-            ejsThrowIOError(ejs, "Cannot write to %s", dest);
-            return 0;
+        if (gzipData(ejs, gz, (cchar*) inbuf, nbytes) < 0) {
+            break;
         }
     }
     mprCloseFile(in);
-    gzclose(out);
+    gzipClose(ejs, gz, 0, 0);
+    mprRemoveRoot(in);
+    mprRemoveRoot(gz);
     return 0;
 }
 
@@ -59019,8 +59858,463 @@ static EjsString *zlib_uncompressString(Ejs *ejs, EjsObj *unused, int argc, EjsO
     return ejsCreateStringFromBytes(ejs, mprGetBufStart(out), mprGetBufLength(out));
 }
 
+/*********************************** GzipStream ******************************/
+/*
+    Write compressed output to the file and update the digests
+ */
+static int writeGzipOutput(Ejs *ejs, EjsGzipStream *gz, cuchar *buf, ssize len)
+{
+    if (len <= 0) {
+        return 0;
+    }
+    if (mprWriteFile(gz->file, buf, len) != len) {
+        ejsThrowIOError(ejs, "Cannot write to %s", gz->path);
+        return MPR_ERR_CANT_WRITE;
+    }
+    if (gz->md5) {
+        mprUpdateDigest(gz->md5, buf, len);
+        mprUpdateDigest(gz->sha256, buf, len);
+    }
+    return 0;
+}
+
+
+/*
+    Deflate a block of data. Use Z_FINISH to flush the stream trailer.
+ */
+static int deflateGzip(Ejs *ejs, EjsGzipStream *gz, cchar *buf, ssize len, int flush)
+{
+    uchar   outbuf[ZBUFSIZE];
+    int     rc;
+
+    gz->zs.next_in = (uchar*) buf;
+    gz->zs.avail_in = (uInt) len;
+    do {
+        gz->zs.avail_out = ZBUFSIZE;
+        gz->zs.next_out = outbuf;
+        if ((rc = deflate(&gz->zs, flush)) == Z_STREAM_ERROR) {
+            ejsThrowIOError(ejs, "Cannot compress data for %s", gz->path);
+            return MPR_ERR_BAD_STATE;
+        }
+        if (writeGzipOutput(ejs, gz, outbuf, ZBUFSIZE - gz->zs.avail_out) < 0) {
+            return MPR_ERR_CANT_WRITE;
+        }
+    } while (gz->zs.avail_out == 0 || (flush == Z_FINISH && rc != Z_STREAM_END));
+    assert(gz->zs.avail_in == 0);
+    return 0;
+}
+
+
+/*
+    Compress a block on a worker thread. Blocks other than the last end with a sync flush so the compressed blocks
+    can be concatenated into a single deflate stream. This does not allocate managed memory.
+ */
+static void compressBlock(GzipBlock *bp)
+{
+    int     rc;
+
+    bp->status = 0;
+    bp->crc = crc32(0L, bp->in, (uInt) bp->inLen);
+    if (deflateReset(&bp->zs) != Z_OK) {
+        bp->status = MPR_ERR_BAD_STATE;
+        return;
+    }
+    if (bp->dictLen > 0 && deflateSetDictionary(&bp->zs, bp->dict, (uInt) bp->dictLen) != Z_OK) {
+        bp->status = MPR_ERR_BAD_STATE;
+        return;
+    }
+    bp->zs.next_in = bp->in;
+    bp->zs.avail_in = (uInt) bp->inLen;
+    bp->zs.next_out = bp->out;
+    bp->zs.avail_out = (uInt) bp->outSize;
+    rc = deflate(&bp->zs, bp->last ? Z_FINISH : Z_SYNC_FLUSH);
+    if ((bp->last && rc != Z_STREAM_END) || (!bp->last && rc != Z_OK) || bp->zs.avail_in > 0) {
+        bp->status = MPR_ERR_BAD_STATE;
+    }
+    bp->outLen = bp->outSize - bp->zs.avail_out;
+}
+
+
+/*
+    Compress blocks until none remain. Worker threads do not allocate managed memory, so they yield to the garbage
+    collector for their lifetime. The calling thread is not yielded as the VM may only collect at its own safe points.
+ */
+static void gzipWorker(EjsGzipStream *gz, MprThread *tp)
+{
+    int     index;
+
+    if (tp) {
+        mprYield(MPR_YIELD_STICKY);
+    }
+    while (1) {
+        mprLock(gz->mutex);
+        index = gz->next++;
+        mprUnlock(gz->mutex);
+        if (index >= gz->count) {
+            break;
+        }
+        compressBlock(&gz->blocks[index]);
+    }
+    mprLock(gz->mutex);
+    if (--gz->running == 0) {
+        mprSignalCond(gz->cond);
+    }
+    mprUnlock(gz->mutex);
+    if (tp) {
+        mprResetYield();
+    }
+}
+
+
+/*
+    Compress the pending blocks concurrently and write them in order. Each block is primed with the tail of the
+    preceding block as a dictionary to preserve the compression ratio.
+ */
+static int compressBlocks(Ejs *ejs, EjsGzipStream *gz, int finish)
+{
+    GzipBlock   *bp;
+    MprThread   *tp;
+    int         i, count;
+
+    count = gz->count;
+    for (i = 0; i < count; i++) {
+        bp = &gz->blocks[i];
+        if (i == 0) {
+            bp->dict = gz->dict;
+            bp->dictLen = gz->dictLen;
+        } else {
+            bp->dict = &gz->blocks[i - 1].in[GZIP_BLOCK - GZIP_DICT];
+            bp->dictLen = GZIP_DICT;
+        }
+        bp->last = (finish && i == (count - 1));
+    }
+    gz->next = 0;
+    gz->running = count;
+    mprHold(gz);
+    for (i = 0; i < count; i++) {
+        if ((tp = mprCreateThread("gzip", gzipWorker, gz, 0)) == 0 || mprStartThread(tp) < 0) {
+            /* Compress the remaining blocks on this thread */
+            gzipWorker(gz, NULL);
+        }
+    }
+    mprLock(gz->mutex);
+    while (gz->running > 0) {
+        mprUnlock(gz->mutex);
+        mprWaitForCond(gz->cond, -1);
+        mprLock(gz->mutex);
+    }
+    mprUnlock(gz->mutex);
+    mprRelease(gz);
+
+    for (i = 0; i < count; i++) {
+        bp = &gz->blocks[i];
+        if (bp->status < 0) {
+            ejsThrowIOError(ejs, "Cannot compress data for %s", gz->path);
+            return MPR_ERR_BAD_STATE;
+        }
+        gz->crc = crc32_combine(gz->crc, bp->crc, (z_off_t) bp->inLen);
+        gz->size += bp->inLen;
+        if (writeGzipOutput(ejs, gz, bp->out, bp->outLen) < 0) {
+            return MPR_ERR_CANT_WRITE;
+        }
+    }
+    /* Keep the tail of the last block as the dictionary for the next block */
+    bp = &gz->blocks[count - 1];
+    gz->dictLen = min(bp->inLen, GZIP_DICT);
+    memcpy(gz->dict, &bp->in[bp->inLen - gz->dictLen], gz->dictLen);
+    for (i = 0; i < count; i++) {
+        gz->blocks[i].inLen = 0;
+    }
+    gz->count = 0;
+    return 0;
+}
+
+
+/*
+    Buffer data into blocks for parallel compression. A full batch of blocks is only compressed when more data
+    arrives, so the last block of data always ends the stream regardless of the number of threads.
+ */
+static int bufferBlocks(Ejs *ejs, EjsGzipStream *gz, cchar *buf, ssize len)
+{
+    GzipBlock   *bp;
+    ssize       n;
+
+    while (len > 0) {
+        if (gz->count == gz->threads && compressBlocks(ejs, gz, 0) < 0) {
+            return MPR_ERR_CANT_WRITE;
+        }
+        bp = &gz->blocks[gz->count];
+        n = min(len, GZIP_BLOCK - bp->inLen);
+        memcpy(&bp->in[bp->inLen], buf, n);
+        bp->inLen += n;
+        buf += n;
+        len -= n;
+        if (bp->inLen == GZIP_BLOCK) {
+            gz->count++;
+        }
+    }
+    return 0;
+}
+
+
+/*
+    Compress data using the serial or parallel compressor
+ */
+static int gzipData(Ejs *ejs, EjsGzipStream *gz, cchar *buf, ssize len)
+{
+    if (gz->threads > 0) {
+        return bufferBlocks(ejs, gz, buf, len);
+    }
+    return deflateGzip(ejs, gz, buf, len, Z_NO_FLUSH);
+}
+
+
+/*
+    Allocate blocks and write the gzip header for parallel compression. The deflate streams are raw and the gzip
+    header and trailer are written here.
+ */
+static int startParallelGzip(Ejs *ejs, EjsGzipStream *gz)
+{
+    GzipBlock   *bp;
+    int         i;
+    /* Magic, deflate method, no flags, no modified time, no extra flags, unix */
+    static uchar header[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 3 };
+
+    /* Ensure the CRC tables are initialized before use by multiple threads */
+    get_crc_table();
+    gz->blocks = mprAllocZeroed(sizeof(GzipBlock) * gz->threads);
+    gz->dict = mprAlloc(GZIP_DICT);
+    gz->mutex = mprCreateLock();
+    gz->cond = mprCreateCond();
+    gz->crc = crc32(0L, Z_NULL, 0);
+    for (i = 0; i < gz->threads; i++) {
+        bp = &gz->blocks[i];
+        if (deflateInit2(&bp->zs, gz->level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            ejsThrowMemoryError(ejs);
+            return MPR_ERR_MEMORY;
+        }
+        bp->active = 1;
+        /* Allow for the sync flush marker */
+        bp->outSize = deflateBound(&bp->zs, GZIP_BLOCK) + 16;
+        bp->in = mprAlloc(GZIP_BLOCK);
+        bp->out = mprAlloc(bp->outSize);
+    }
+    return writeGzipOutput(ejs, gz, header, sizeof(header));
+}
+
+
+/*
+    Compress the final block and write the gzip trailer
+ */
+static int finishParallelGzip(Ejs *ejs, EjsGzipStream *gz)
+{
+    uchar   trailer[8];
+    int     i;
+
+    if (gz->count == 0 || (gz->count < gz->threads && gz->blocks[gz->count].inLen > 0)) {
+        gz->count++;
+    }
+    if (compressBlocks(ejs, gz, 1) < 0) {
+        return MPR_ERR_CANT_WRITE;
+    }
+    for (i = 0; i < 4; i++) {
+        trailer[i] = (uchar) (gz->crc >> (i * 8));
+        trailer[i + 4] = (uchar) (gz->size >> (i * 8));
+    }
+    return writeGzipOutput(ejs, gz, trailer, sizeof(trailer));
+}
+
+
+static void endParallelGzip(EjsGzipStream *gz)
+{
+    int     i;
+
+    if (gz->blocks) {
+        for (i = 0; i < gz->threads; i++) {
+            if (gz->blocks[i].active) {
+                deflateEnd(&gz->blocks[i].zs);
+                gz->blocks[i].active = 0;
+            }
+        }
+    }
+}
+
+
+/*
+    function GzipStream(path: Path, options: Object? = null)
+ */
+static EjsGzipStream *gzipConstructor(Ejs *ejs, EjsGzipStream *gz, int argc, EjsObj **argv)
+{
+    EjsObj      *options, *vp;
+
+    gz->path = ((EjsPath*) argv[0])->value;
+    options = (argc >= 2) ? argv[1] : 0;
+    gz->level = Z_DEFAULT_COMPRESSION;
+
+    if (ejsIsDefined(ejs, options)) {
+        if ((vp = ejsGetPropertyByName(ejs, options, EN("level"))) != 0 && ejsIs(ejs, vp, Number)) {
+            gz->level = max(0, min(ejsGetInt(ejs, vp), 9));
+        }
+        if ((vp = ejsGetPropertyByName(ejs, options, EN("threads"))) != 0) {
+            if (vp == ESV(true)) {
+                gz->threads = mprGetMemStats()->cpuCores;
+            } else if (ejsIs(ejs, vp, Number)) {
+                gz->threads = ejsGetInt(ejs, vp);
+            }
+            /* A single thread uses the serial compressor */
+            gz->threads = (gz->threads > 1) ? gz->threads : 0;
+        }
+        if (ejsGetPropertyByName(ejs, options, EN("digest")) == ESV(true)) {
+            gz->md5 = mprCreateDigest(MPR_DIGEST_MD5);
+            gz->sha256 = mprCreateDigest(MPR_DIGEST_SHA256);
+        }
+    }
+    if ((gz->file = mprOpenFile(gz->path, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0644)) == 0) {
+        ejsThrowIOError(ejs, "Cannot open destination %s", gz->path);
+        return 0;
+    }
+    if (gz->threads > 0) {
+        gz->active = 1;
+        if (startParallelGzip(ejs, gz) < 0) {
+            gzipClose(ejs, gz, 0, 0);
+            return 0;
+        }
+        return gz;
+    }
+    /*
+        Add 16 to the window bits to select a gzip wrapper
+     */
+    if (deflateInit2(&gz->zs, gz->level, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    gz->active = 1;
+    return gz;
+}
+
+
+/*
+    function write(...data): Number
+ */
+static EjsNumber *gzipWrite(Ejs *ejs, EjsGzipStream *gz, int argc, EjsObj **argv)
+{
+    EjsArray        *args;
+    EjsByteArray    *ap;
+    EjsObj          *vp;
+    cchar           *buf;
+    ssize           len, written;
+    int             i;
+
+    assert(argc == 1 && ejsIs(ejs, argv[0], Array));
+    args = (EjsArray*) argv[0];
+
+    if (!gz->active) {
+        ejsThrowStateError(ejs, "GzipStream is closed");
+        return 0;
+    }
+    written = 0;
+    for (i = 0; i < args->length; i++) {
+        vp = ejsGetProperty(ejs, (EjsObj*) args, i);
+        if (ejsIs(ejs, vp, ByteArray)) {
+            ap = (EjsByteArray*) vp;
+            buf = (cchar*) &ap->value[ap->readPosition];
+            len = ap->writePosition - ap->readPosition;
+        } else {
+            buf = ejsToMulti(ejs, vp);
+            len = slen(buf);
+        }
+        if (gzipData(ejs, gz, buf, len) < 0) {
+            return 0;
+        }
+        written += len;
+    }
+    return ejsCreateNumber(ejs, (MprNumber) written);
+}
+
+
+/*
+    function close(): Void
+ */
+static EjsObj *gzipClose(Ejs *ejs, EjsGzipStream *gz, int argc, EjsObj **argv)
+{
+    int     rc;
+
+    if (!gz->active) {
+        return 0;
+    }
+    if (gz->threads > 0) {
+        rc = ejs->exception ? MPR_ERR_BAD_STATE : finishParallelGzip(ejs, gz);
+        endParallelGzip(gz);
+    } else {
+        rc = deflateGzip(ejs, gz, NULL, 0, Z_FINISH);
+        deflateEnd(&gz->zs);
+    }
+    gz->active = 0;
+    mprCloseFile(gz->file);
+    gz->file = 0;
+    if (rc == 0 && gz->md5) {
+        gz->md5sum = mprFinalizeDigest(gz->md5);
+        gz->sha256sum = mprFinalizeDigest(gz->sha256);
+    }
+    return 0;
+}
+
+
+/*
+    function get md5(): String?
+ */
+static EjsObj *gzipMd5(Ejs *ejs, EjsGzipStream *gz, int argc, EjsObj **argv)
+{
+    return gz->md5sum ? (EjsObj*) ejsCreateStringFromAsc(ejs, gz->md5sum) : ESV(null);
+}
+
+
+/*
+    function get sha256(): String?
+ */
+static EjsObj *gzipSha256(Ejs *ejs, EjsGzipStream *gz, int argc, EjsObj **argv)
+{
+    return gz->sha256sum ? (EjsObj*) ejsCreateStringFromAsc(ejs, gz->sha256sum) : ESV(null);
+}
+
 /*********************************** Factory *******************************/
 
+static void manageGzipStream(EjsGzipStream *gz, int flags)
+{
+    int     i;
+
+    if (flags & MPR_MANAGE_MARK) {
+        ejsManagePot(gz, flags);
+        mprMark(gz->path);
+        mprMark(gz->file);
+        mprMark(gz->md5);
+        mprMark(gz->sha256);
+        mprMark(gz->md5sum);
+        mprMark(gz->sha256sum);
+        mprMark(gz->blocks);
+        mprMark(gz->dict);
+        mprMark(gz->mutex);
+        mprMark(gz->cond);
+        if (gz->blocks) {
+            for (i = 0; i < gz->threads; i++) {
+                mprMark(gz->blocks[i].in);
+                mprMark(gz->blocks[i].out);
+            }
+        }
+
+    } else if (flags & MPR_MANAGE_FREE) {
+        if (gz->active) {
+            if (gz->threads > 0) {
+                endParallelGzip(gz);
+            } else {
+                deflateEnd(&gz->zs);
+            }
+            gz->active = 0;
+        }
+    }
+}
+
+
 #if UNUSED
 static int manageZlib(EjsZlib *db, int flags)
 {
@@ -59040,6 +60334,7 @@ static int manageZlib(EjsZlib *db, int flags)
 static int configureZlibTypes(Ejs *ejs)
 {
     EjsType     *type;
+    EjsPot      *prototype;
     
     if ((type = ejsFinalizeScriptType(ejs, N("ejs.zlib", "Zlib"), 0, NULL, 0)) == 0) {
         return 0;
@@ -59050,6 +60345,17 @@ static int configureZlibTypes(Ejs *ejs)
     ejsBindMethod(ejs, type, ES_ejs_zlib_Zlib_uncompressBytes, zlib_uncompressBytes);
     ejsBindMethod(ejs, type, ES_ejs_zlib_Zlib_compressString, zlib_compressString);
     ejsBindMethod(ejs, type, ES_ejs_zlib_Zlib_uncompressString, zlib_uncompressString);
+
+    if ((type = ejsFinalizeScriptType(ejs, N("ejs.zlib", "GzipStream"), sizeof(EjsGzipStream), manageGzipStream,
+            EJS_TYPE_POT)) == 0) {
+        return 0;
+    }
+    prototype = type->prototype;
+    ejsBindConstructor(ejs, type, gzipConstructor);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_GzipStream_write, gzipWrite);
+    ejsBindMethod(ejs, prototype, ES_ejs_zlib_GzipStream_close, gzipClose);
+    ejsBindAccess(ejs, prototype, ES_ejs_zlib_GzipStream_md5, gzipMd5, 0);
+    ejsBindAccess(ejs, prototype, ES_ejs_zlib_GzipStream_sha256, gzipSha256, 0);
     return 0;
 }
 
@@ -67901,6 +69207,7 @@ static void defineSharedTypes(Ejs *ejs)
     #if ME_COM_SQLITE && ME_EJSCRIPT_DB
         ejs_db_sqlite_Init(ejs, NULL);
     #endif
+    ejs_digest_Init(ejs, NULL);
 #if ME_EJSCRIPT_WEB
     ejs_web_Init(ejs, NULL);
 #endif
@@ -4588,9 +4588,9 @@ PUBLIC MprList *mprGetDirList(cchar *path);
          Note: Individual files are not thread-safe and should only be used by one file.
     @stability Stable.
     @see MprFile mprAttachFileFd mprCloseFile mprDisableFileBuffering mprEnableFileBuffering mprFlushFile mprGetFileChar
-        mprGetFilePosition mprGetFileSize mprGetStderr mprGetStdin mprGetStdout mprOpenFile
+        mprGetFilePosition mprGetFileSize mprGetStderr mprGetStdin mprGetStdout mprMapFile mprOpenFile
         mprPeekFileChar mprPutFileChar mprPutFileString mprReadFile mprReadLine mprSeekFile mprTruncateFile mprWriteFile
-        mprWriteFileFmt mprWriteFileString
+        mprWriteFileFmt mprWriteFileString mprUnmapFile
         mprGetFileFd
     @defgroup MprFile MprFile
  */
@@ -4734,6 +4734,62 @@ PUBLIC MprFile *mprGetStdin(void);
  */
 PUBLIC MprFile *mprGetStdout(void);
 
+/*
+    Access advice flags for mprMapFile. These may be ored with MPR_MAP_WRITE.
+ */
+#define MPR_MAP_SEQUENTIAL  0x100       /**< Data will be accessed sequentially. Enables aggressive read-ahead. */
+#define MPR_MAP_WILLNEED    0x200       /**< All the data will be needed soon. Starts read-ahead immediately. */
+
+#ifndef ME_MPR_MAP_MIN
+    #define ME_MPR_MAP_MIN  (64 * 1024) /**< Files smaller than this are read rather than mapped */
+#endif
+#ifndef ME_MPR_MAP_FILES
+    #if ME_COMPILER_HAS_MMU && ME_UNIX_LIKE && !ME_ROM
+        #define ME_MPR_MAP_FILES 1      /**< mprMapFile uses mmap. Otherwise files are read into memory. */
+    #else
+        #define ME_MPR_MAP_FILES 0
+    #endif
+#endif
+
+/**
+    Mapped file contents returned by mprMapFile
+    @ingroup MprFile
+    @stability Prototype
+ */
+typedef struct MprFileMap {
+    char            *data;              /**< File contents. Null terminated if the file was read into memory. */
+    MprOff          size;               /**< Length of the file contents */
+    int             mapped;             /**< Contents are memory mapped. Otherwise they are allocated. */
+} MprFileMap;
+
+/**
+    Map a file into memory
+    @description Map the contents of a file for reading. On systems with virtual memory, the file is mapped read-only
+        (or private copy-on-write if MPR_MAP_WRITE is specified) and the kernel is advised of the expected access
+        pattern. This avoids copying the file into intermediate buffers. Small files, empty files, ROM files and
+        systems without virtual memory read the file into allocated memory instead. The mapping is released when the
+        map object is freed by the garbage collector or when #mprUnmapFile is called.
+    @param path Filename to map
+    @param flags Set to MPR_MAP_SEQUENTIAL to advise sequential access, MPR_MAP_WILLNEED to start reading the
+        data immediately and MPR_MAP_WRITE to permit private modifications to the data. Modifications are never
+        written to the file.
+    @return A file map object. The data is available via map->data and map->size. Returns null if the file cannot
+        be read.
+    @ingroup MprFile
+    @stability Prototype
+ */
+PUBLIC MprFileMap *mprMapFile(cchar *path, int flags);
+
+/**
+    Release a file mapping
+    @description Unmap a file mapped via #mprMapFile. Thereafter, the map data must not be accessed.
+        This is optional. Mappings are also released when the map object is freed by the garbage collector.
+    @param map File map returned by #mprMapFile
+    @ingroup MprFile
+    @stability Prototype
+ */
+PUBLIC void mprUnmapFile(MprFileMap *map);
+
 /**
     Open a file
     @description Open a file and return a file object.
@@ -4936,11 +4992,13 @@ typedef struct MprDirEntry {
 
 /**
     Copy a file
-    @description Create a new copy of a file with the specified open permissions mode.
+    @description Create a new copy of a file with the specified open permissions mode. On Linux, the copy is made
+        via a reflink clone if the file system supports it, otherwise the kernel copies the data via copy_file_range
+        or sendfile. Other systems use read/write. This routine does not allocate memory unless a ROM file system is used.
     @param from Path of the existing file to copy
     @param to Name of the new file copy
     @param omode Posix style file open mode mask. See #mprOpenFile for the various modes.
-    @returns True if the file exists and can be accessed
+    @returns Zero if successful, otherwise a negative MPR error code is returned.
     @ingroup MprPath
     @stability Stable
  */
@@ -7613,8 +7671,8 @@ PUBLIC void mprCloseSocket(MprSocket *sp, bool graceful);
     Connect a client socket
     @description Open a client connection
     @param sp Socket object returned via #mprCreateSocket
-    @param ip Host or IP address to connect to.
-    @param port TCP/IP port number to connect to.
+    @param ip Host or IP address to connect to. On Unix systems, this may be the absolute path of a Unix domain socket.
+    @param port TCP/IP port number to connect to. Ignored for Unix domain sockets.
     @param flags Socket flags may use the following flags ored together:
         @li MPR_SOCKET_BLOCK - to use blocking I/O. The default is non-blocking.
         @li MPR_SOCKET_BROADCAST - Use IPv4 broadcast
@@ -7698,8 +7756,8 @@ PUBLIC Socket mprGetSocketHandle(MprSocket *sp);
 
 /**
     Get the socket for an IP:Port address
-    @param ip IP address or hostname
-    @param port Port number
+    @param ip IP address or hostname. On Unix systems, an absolute path selects a Unix domain socket.
+    @param port Port number. Ignored for Unix domain sockets.
     @param family Output parameter to contain the Internet protocol family
     @param protocol Output parameter to contain the Internet TCP/IP protocol
     @param addr Output parameter to contain the sockaddr description of the socket address
@@ -7803,7 +7861,8 @@ PUBLIC bool mprIsSocketEof(MprSocket *sp);
         If ip is null, then this will listen on both IPv6 and IPv4.
     @param sp Socket object returned via #mprCreateSocket
     @param ip IP address to bind to. Set to 0.0.0.0 to bind to all possible addresses on a given port.
-    @param port TCP/IP port number to connect to.
+        On Unix systems, this may be the absolute path of a Unix domain socket to create. The path must not exist.
+    @param port TCP/IP port number to connect to. Ignored for Unix domain sockets.
     @param flags Socket flags may use the following flags ored together:
         @li MPR_SOCKET_BLOCK - to use blocking I/O. The default is non-blocking.
         @li MPR_SOCKET_BROADCAST - Use IPv4 broadcast
@@ -8587,6 +8646,49 @@ PUBLIC char *mprGetSHAWithPrefix(cchar *buf, ssize len, cchar *prefix);
  */
 PUBLIC char *mprGetSHABase64(cchar *str);
 
+#define MPR_DIGEST_MD5      1           /**< MD5 digest algorithm */
+#define MPR_DIGEST_SHA1     2           /**< SHA-1 digest algorithm */
+#define MPR_DIGEST_SHA256   3           /**< SHA-256 digest algorithm */
+
+/**
+    Incremental message digest
+    @description Digests are computed over data supplied in any number of calls to #mprUpdateDigest so that
+        large files and streams can be hashed with bounded memory.
+    @see mprCreateDigest mprFinalizeDigest mprUpdateDigest
+    @defgroup MprDigest MprDigest
+    @stability Prototype
+ */
+typedef struct MprDigest MprDigest;
+
+/**
+    Create an incremental digest
+    @param type Digest algorithm. Set to MPR_DIGEST_MD5, MPR_DIGEST_SHA1 or MPR_DIGEST_SHA256.
+    @returns A digest object or null if the type is not supported.
+    @ingroup MprDigest
+    @stability Prototype
+ */
+PUBLIC MprDigest *mprCreateDigest(int type);
+
+/**
+    Add data to a digest
+    @param dp Digest created via #mprCreateDigest
+    @param buf Data to add
+    @param len Length of the data in bytes
+    @ingroup MprDigest
+    @stability Prototype
+ */
+PUBLIC void mprUpdateDigest(MprDigest *dp, cvoid *buf, ssize len);
+
+/**
+    Finalize a digest
+    @description The digest cannot be updated after calling this routine.
+    @param dp Digest created via #mprCreateDigest
+    @returns An allocated string containing the digest in hex.
+    @ingroup MprDigest
+    @stability Prototype
+ */
+PUBLIC char *mprFinalizeDigest(MprDigest *dp);
+
 /**
     Encrypt a password using the Blowfish algorithm
     @param password User's password to encrypt
@@ -8876,7 +8978,7 @@ typedef struct MprCmdFile {
         read, write and error data with the command.
     @stability Stable.
     @see mprCloseCmdFd mprCreateCmd mprDestroyCmd mprDisableCmdEvents mprDisconnectCmd mprEnableCmdEvents
-        mprFinalizeCmd mprGetCmdBuf mprGetCmdExitStatus mprGetCmdFd mprIsCmdComplete mprIsCmdRunning
+        mprFinalizeCmd mprGetCmdBuf mprGetCmdExitStatus mprGetCmdFd mprGetCmdUsage mprIsCmdComplete mprIsCmdRunning
         mprReadCmd mprReapCmd mprRunCmd mprRunCmdV mprSetCmdCallback mprSetCmdDir mprSetCmdEnv mprSetCmdSearchPath
         mprStartCmd mprStopCmd mprWaitForCmd mprWriteCmd mprWriteCmdBlock
     @defgroup MprCmd MprCmd
@@ -8894,6 +8996,7 @@ typedef struct MprCmd {
     int             timedout;           /**< Request has timedout */
     bool            complete: 1;        /**< All channels EOF and status gathered */
     bool            stopped: 1;         /**< Command stopped */
+    bool            hasUsage: 1;        /**< Resource usage was gathered when the process was reaped */
     cchar           **makeArgv;         /**< Allocated argv */
     cchar           **argv;             /**< List of args. Null terminated */
     char            *dir;               /**< Current working dir for the process */
@@ -8925,6 +9028,9 @@ typedef struct MprCmd {
     SEM_ID          startCond;          /**< Synchronization semaphore for task start */
     SEM_ID          exitCond;           /**< Synchronization semaphore for task exit */
 #endif
+    MprTicks        userTime;           /**< User CPU time of the reaped process in msec */
+    MprTicks        sysTime;            /**< System CPU time of the reaped process in msec */
+    int64           maxRss;             /**< Maximum resident set size of the reaped process in bytes */
     MprMutex        *mutex;             /**< Multithread sync */
 } MprCmd;
 
@@ -9037,6 +9143,20 @@ PUBLIC MprBuf *mprGetCmdBuf(MprCmd *cmd, int channel);
  */
 PUBLIC int mprGetCmdExitStatus(MprCmd *cmd);
 
+/**
+    Get the resource usage of a completed command
+    @description The CPU times and maximum resident set size are gathered when the process is reaped.
+        This is supported on Linux, Mac OS X and FreeBSD.
+    @param cmd MprCmd object created via mprCreateCmd
+    @param userTime Set to the user CPU time in milliseconds
+    @param sysTime Set to the system CPU time in milliseconds
+    @param maxRss Set to the maximum resident set size in bytes
+    @return Zero if the usage is available. Otherwise, a negative error code is returned.
+    @ingroup MprCmd
+    @stability Prototype
+ */
+PUBLIC int mprGetCmdUsage(MprCmd *cmd, MprTicks *userTime, MprTicks *sysTime, int64 *maxRss);
+
 /**
     Get the underlying file descriptor for an I/O channel
     @param cmd MprCmd object created via mprCreateCmd
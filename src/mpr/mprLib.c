@@ -5603,6 +5603,7 @@ static void resetCmd(MprCmd *cmd, bool finalizing)
     }
     cmd->eofCount = 0;
     cmd->complete = 0;
+    cmd->hasUsage = 0;
     cmd->status = -1;
 
     if (cmd->pid && (!(cmd->flags & MPR_CMD_DETACH) || finalizing)) {
@@ -6255,7 +6256,27 @@ static void reapCmd(MprCmd *cmd, bool finalizing)
     int     status, rc;
 
     status = 0;
-    if ((rc = waitpid(cmd->pid, &status, WNOHANG | __WALL)) < 0) {
+#if LINUX || MACOSX || FREEBSD
+{
+    struct rusage   usage;
+
+    memset(&usage, 0, sizeof(usage));
+    rc = wait4(cmd->pid, &status, WNOHANG | __WALL, &usage);
+    if (rc == cmd->pid && !WIFSTOPPED(status)) {
+        cmd->userTime = usage.ru_utime.tv_sec * TPS + usage.ru_utime.tv_usec / 1000;
+        cmd->sysTime = usage.ru_stime.tv_sec * TPS + usage.ru_stime.tv_usec / 1000;
+#if MACOSX
+        cmd->maxRss = usage.ru_maxrss;
+#else
+        cmd->maxRss = (int64) usage.ru_maxrss * 1024;
+#endif
+        cmd->hasUsage = 1;
+    }
+}
+#else
+    rc = waitpid(cmd->pid, &status, WNOHANG | __WALL);
+#endif
+    if (rc < 0) {
         mprLog("error mpr cmd", 0, "Waitpid failed for pid %d, errno %d", cmd->pid, errno);
 
     } else if (rc == cmd->pid) {
@@ -6421,6 +6442,20 @@ PUBLIC int mprGetCmdExitStatus(MprCmd *cmd)
 }
 
 
+PUBLIC int mprGetCmdUsage(MprCmd *cmd, MprTicks *userTime, MprTicks *sysTime, int64 *maxRss)
+{
+    assert(cmd);
+
+    if (cmd->pid || !cmd->hasUsage) {
+        return MPR_ERR_NOT_READY;
+    }
+    *userTime = cmd->userTime;
+    *sysTime = cmd->sysTime;
+    *maxRss = cmd->maxRss;
+    return 0;
+}
+
+
 PUBLIC bool mprIsCmdRunning(MprCmd *cmd)
 {
     return cmd->pid > 0;
@@ -7631,6 +7666,29 @@ typedef struct MprSha {
 
 #define shaShift(bits,word) (((word) << (bits)) | ((word) >> (32-(bits))))
 
+#define SHA256_SIZE 32
+
+typedef struct MprSha256 {
+    uint    hash[SHA256_SIZE / 4];  /* Message Digest */
+    uint64  length;                 /* Message length in bits */
+    int     index;                  /* Index into message block array */
+    uchar   block[64];              /* 512-bit message blocks */
+} MprSha256;
+
+#define sha256Rotate(bits,word) (((word) >> (bits)) | ((word) << (32-(bits))))
+
+/*
+    Incremental digest state. The algorithm is selected by type.
+ */
+struct MprDigest {
+    int         type;               /* MPR_DIGEST_MD5, MPR_DIGEST_SHA1 or MPR_DIGEST_SHA256 */
+    union {
+        MD5CONTEXT  md5;
+        MprSha      sha1;
+        MprSha256   sha256;
+    } ctx;
+};
+
 /*************************** Forward Declarations *****************************/
 
 static void decode(uint *output, uchar *input, uint len);
@@ -7646,6 +7704,11 @@ static void shaFinalize(uchar *digest, MprSha *sha);
 static void shaPad(MprSha *sha);
 static void shaProcess(MprSha *sha);
 
+static void sha256Init(MprSha256 *sha);
+static void sha256Update(MprSha256 *sha, cuchar *msg, ssize len);
+static void sha256Finalize(uchar *digest, MprSha256 *sha);
+static void sha256Process(MprSha256 *sha);
+
 /*********************************** Code *************************************/
 
 PUBLIC int mprRandom()
@@ -8215,6 +8278,197 @@ static void shaPad(MprSha *sha)
     shaProcess(sha);
 }
 
+/************************************ Sha256 *********************************/
+
+static const uint sha256K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+
+static void sha256Init(MprSha256 *sha)
+{
+    sha->length = 0;
+    sha->index = 0;
+    sha->hash[0] = 0x6a09e667;
+    sha->hash[1] = 0xbb67ae85;
+    sha->hash[2] = 0x3c6ef372;
+    sha->hash[3] = 0xa54ff53a;
+    sha->hash[4] = 0x510e527f;
+    sha->hash[5] = 0x9b05688c;
+    sha->hash[6] = 0x1f83d9ab;
+    sha->hash[7] = 0x5be0cd19;
+}
+
+
+static void sha256Update(MprSha256 *sha, cuchar *msg, ssize len)
+{
+    ssize   count;
+
+    sha->length += ((uint64) len) * 8;
+    while (len > 0) {
+        count = min(len, 64 - sha->index);
+        memcpy(&sha->block[sha->index], msg, count);
+        sha->index += (int) count;
+        msg += count;
+        len -= count;
+        if (sha->index == 64) {
+            sha256Process(sha);
+        }
+    }
+}
+
+
+static void sha256Finalize(uchar *digest, MprSha256 *sha)
+{
+    uint64  length;
+    int     i;
+
+    length = sha->length;
+    sha->block[sha->index++] = 0x80;
+    if (sha->index > 56) {
+        memset(&sha->block[sha->index], 0, 64 - sha->index);
+        sha256Process(sha);
+    }
+    memset(&sha->block[sha->index], 0, 56 - sha->index);
+    for (i = 0; i < 8; i++) {
+        sha->block[63 - i] = (uchar) (length >> (i * 8));
+    }
+    sha256Process(sha);
+    for (i = 0; i < SHA256_SIZE; i++) {
+        digest[i] = (uchar) (sha->hash[i >> 2] >> 8 * (3 - (i & 0x03)));
+    }
+    memset(sha, 0, sizeof(MprSha256));
+}
+
+
+static void sha256Process(MprSha256 *sha)
+{
+    uint    W[64], A, B, C, D, E, F, G, H, t1, t2;
+    int     t;
+
+    for (t = 0; t < 16; t++) {
+        W[t] = sha->block[t * 4] << 24;
+        W[t] |= sha->block[t * 4 + 1] << 16;
+        W[t] |= sha->block[t * 4 + 2] << 8;
+        W[t] |= sha->block[t * 4 + 3];
+    }
+    for (t = 16; t < 64; t++) {
+        W[t] = (sha256Rotate(17, W[t-2]) ^ sha256Rotate(19, W[t-2]) ^ (W[t-2] >> 10)) + W[t-7] +
+            (sha256Rotate(7, W[t-15]) ^ sha256Rotate(18, W[t-15]) ^ (W[t-15] >> 3)) + W[t-16];
+    }
+    A = sha->hash[0];
+    B = sha->hash[1];
+    C = sha->hash[2];
+    D = sha->hash[3];
+    E = sha->hash[4];
+    F = sha->hash[5];
+    G = sha->hash[6];
+    H = sha->hash[7];
+
+    for (t = 0; t < 64; t++) {
+        t1 = H + (sha256Rotate(6, E) ^ sha256Rotate(11, E) ^ sha256Rotate(25, E)) + ((E & F) ^ ((~E) & G)) +
+            sha256K[t] + W[t];
+        t2 = (sha256Rotate(2, A) ^ sha256Rotate(13, A) ^ sha256Rotate(22, A)) + ((A & B) ^ (A & C) ^ (B & C));
+        H = G;
+        G = F;
+        F = E;
+        E = D + t1;
+        D = C;
+        C = B;
+        B = A;
+        A = t1 + t2;
+    }
+    sha->hash[0] += A;
+    sha->hash[1] += B;
+    sha->hash[2] += C;
+    sha->hash[3] += D;
+    sha->hash[4] += E;
+    sha->hash[5] += F;
+    sha->hash[6] += G;
+    sha->hash[7] += H;
+    sha->index = 0;
+}
+
+/************************************ Digest *********************************/
+
+PUBLIC MprDigest *mprCreateDigest(int type)
+{
+    MprDigest   *dp;
+
+    if (type != MPR_DIGEST_MD5 && type != MPR_DIGEST_SHA1 && type != MPR_DIGEST_SHA256) {
+        return 0;
+    }
+    if ((dp = mprAllocStruct(MprDigest)) == 0) {
+        return 0;
+    }
+    dp->type = type;
+    if (type == MPR_DIGEST_MD5) {
+        initMD5(&dp->ctx.md5);
+    } else if (type == MPR_DIGEST_SHA1) {
+        shaInit(&dp->ctx.sha1);
+    } else {
+        sha256Init(&dp->ctx.sha256);
+    }
+    return dp;
+}
+
+
+PUBLIC void mprUpdateDigest(MprDigest *dp, cvoid *buf, ssize len)
+{
+    cuchar  *cp;
+    uint    count;
+
+    if (dp->type == MPR_DIGEST_MD5) {
+        for (cp = buf; len > 0; cp += count, len -= count) {
+            count = (uint) min(len, MAXINT);
+            update(&dp->ctx.md5, (uchar*) cp, count);
+        }
+    } else if (dp->type == MPR_DIGEST_SHA1) {
+        shaUpdate(&dp->ctx.sha1, buf, len);
+    } else {
+        sha256Update(&dp->ctx.sha256, buf, len);
+    }
+}
+
+
+/*
+    Finalize the digest and return the result as an allocated hex string. The digest cannot be updated after this call.
+ */
+PUBLIC char *mprFinalizeDigest(MprDigest *dp)
+{
+    uchar   hash[SHA256_SIZE];
+    cchar   *hex = "0123456789abcdef";
+    char    *result, *r;
+    int     i, size;
+
+    if (dp->type == MPR_DIGEST_MD5) {
+        finalizeMD5(hash, &dp->ctx.md5);
+        size = CRYPT_HASH_SIZE;
+    } else if (dp->type == MPR_DIGEST_SHA1) {
+        shaFinalize(hash, &dp->ctx.sha1);
+        size = SHA_SIZE;
+    } else {
+        sha256Finalize(hash, &dp->ctx.sha256);
+        size = SHA256_SIZE;
+    }
+    if ((result = mprAlloc((size * 2) + 1)) == 0) {
+        return 0;
+    }
+    for (i = 0, r = result; i < size; i++) {
+        *r++ = hex[hash[i] >> 4];
+        *r++ = hex[hash[i] & 0xF];
+    }
+    *r = '\0';
+    return result;
+}
+
 /************************************ Blowfish *******************************/
 
 #define BF_ROUNDS 16
@@ -11354,6 +11608,7 @@ PUBLIC void mprDequeueEvent(MprEvent *event)
 
 static ssize fillBuf(MprFile *file);
 static void manageFile(MprFile *file, int flags);
+static void manageFileMap(MprFileMap *map, int flags);
 
 /************************************ Code ************************************/
 
@@ -11754,6 +12009,16 @@ PUBLIC ssize mprReadFile(MprFile *file, void *buf, ssize size)
         bufStart = buf;
         while (size > 0) {
             if (mprGetBufLength(bp) == 0) {
+                if (size >= mprGetBufSize(bp)) {
+                    /* Read large requests directly rather than copying through the buffer */
+                    bytes = fs->readFile(file, buf, size);
+                    if (bytes <= 0) {
+                        return -1;
+                    }
+                    buf = (void*) (((char*) buf) + bytes);
+                    size -= bytes;
+                    continue;
+                }
                 bytes = fillBuf(file);
                 if (bytes <= 0) {
                     return -1;
@@ -11950,6 +12215,85 @@ PUBLIC int mprGetFileFd(MprFile *file)
     return file->fd;
 }
 
+
+PUBLIC MprFileMap *mprMapFile(cchar *path, int flags)
+{
+    MprFileMap  *map;
+    ssize       len;
+#if ME_MPR_MAP_FILES
+    struct stat sbuf;
+    void        *data;
+    int         fd, prot;
+#endif
+
+    if ((map = mprAllocObj(MprFileMap, manageFileMap)) == 0) {
+        return 0;
+    }
+#if ME_MPR_MAP_FILES
+    if ((fd = open(path, O_RDONLY)) < 0) {
+        return 0;
+    }
+    if (fstat(fd, &sbuf) == 0 && S_ISREG(sbuf.st_mode) && sbuf.st_size >= ME_MPR_MAP_MIN &&
+            (uint64) sbuf.st_size <= MAXSSIZE) {
+        prot = PROT_READ | ((flags & MPR_MAP_WRITE) ? PROT_WRITE : 0);
+        if ((data = mmap(0, (size_t) sbuf.st_size, prot, MAP_PRIVATE, fd, 0)) != MAP_FAILED) {
+#if defined(MADV_SEQUENTIAL)
+            if (flags & MPR_MAP_SEQUENTIAL) {
+                madvise(data, (size_t) sbuf.st_size, MADV_SEQUENTIAL);
+            }
+#endif
+#if defined(MADV_WILLNEED)
+            if (flags & MPR_MAP_WILLNEED) {
+                madvise(data, (size_t) sbuf.st_size, MADV_WILLNEED);
+            }
+#endif
+            close(fd);
+            map->data = data;
+            map->size = sbuf.st_size;
+            map->mapped = 1;
+            return map;
+        }
+    }
+    close(fd);
+#endif
+    /*
+        Read small files and files that cannot be mapped
+     */
+    if ((map->data = mprReadPathContents(path, &len)) == 0) {
+        return 0;
+    }
+    map->size = len;
+    return map;
+}
+
+
+PUBLIC void mprUnmapFile(MprFileMap *map)
+{
+    if (map == 0) {
+        return;
+    }
+#if ME_MPR_MAP_FILES
+    if (map->mapped) {
+        munmap(map->data, (size_t) map->size);
+    }
+#endif
+    map->mapped = 0;
+    map->data = 0;
+    map->size = 0;
+}
+
+
+static void manageFileMap(MprFileMap *map, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        if (!map->mapped) {
+            mprMark(map->data);
+        }
+    } else if (flags & MPR_MANAGE_FREE) {
+        mprUnmapFile(map);
+    }
+}
+
 /*
     Copyright (c) Embedthis Software. All Rights Reserved.
     This software is distributed under commercial and open source licenses.
@@ -15535,9 +15879,19 @@ static void swapElt(char *a, char *b, ssize width)
 }
 
 
+/*
+    Partitions smaller than this are insertion sorted
+ */
+#define MPR_SORT_MIN    8
+
+/*
+    Quicksort using a median of three pivot so that sorted input (e.g. directory listings) does not go quadratic.
+    Recurses on the smaller partition to bound the stack depth.
+ */
 PUBLIC void *mprSort(void *base, ssize nelt, ssize esize, MprSortProc cmp, void *ctx)
 {
-    char    *array, *pivot, *left, *right, *end;
+    char    *array, *pivot, *left, *right, *mid, *ep;
+    ssize   nleft, nright;
 
     if (nelt < 2 || esize <= 0) {
         return base;
@@ -15546,25 +15900,56 @@ PUBLIC void *mprSort(void *base, ssize nelt, ssize esize, MprSortProc cmp, void
         cmp = (MprSortProc) defaultSort;
     }
     array = base;
-    end = array + (nelt * esize);
-    left = array;
-    right = array + ((nelt - 1) * esize);
-    pivot = array;
 
-    while (left < right) {
-        while (left < end && cmp(left, pivot, ctx) <= 0) {
-            left += esize;
+    while (nelt > MPR_SORT_MIN) {
+        mid = array + (nelt / 2) * esize;
+        right = array + ((nelt - 1) * esize);
+        if (cmp(mid, array, ctx) < 0) {
+            swapElt(mid, array, esize);
         }
-        while (cmp(right, pivot, ctx) > 0) {
-            right -= esize;
+        if (cmp(right, array, ctx) < 0) {
+            swapElt(right, array, esize);
+        }
+        if (cmp(right, mid, ctx) < 0) {
+            swapElt(right, mid, esize);
         }
-        if (left < right) {
+        /* Use the median as the pivot in the first element */
+        swapElt(array, mid, esize);
+        pivot = array;
+        left = array + esize;
+
+        while (1) {
+            while (left <= right && cmp(left, pivot, ctx) < 0) {
+                left += esize;
+            }
+            while (cmp(right, pivot, ctx) > 0) {
+                right -= esize;
+            }
+            if (left >= right) {
+                break;
+            }
             swapElt(left, right, esize);
+            left += esize;
+            right -= esize;
+        }
+        swapElt(pivot, right, esize);
+
+        nleft = (right - array) / esize;
+        nright = nelt - nleft - 1;
+        if (nleft < nright) {
+            mprSort(array, nleft, esize, cmp, ctx);
+            array = right + esize;
+            nelt = nright;
+        } else {
+            mprSort(right + esize, nright, esize, cmp, ctx);
+            nelt = nleft;
+        }
+    }
+    for (left = array + esize, ep = array + (nelt * esize); left < ep; left += esize) {
+        for (right = left; right > array && cmp(right - esize, right, ctx) > 0; right -= esize) {
+            swapElt(right - esize, right, esize);
         }
     }
-    swapElt(pivot, right, esize);
-    mprSort(array, (right - array) / esize, esize, cmp, ctx);
-    mprSort(left, nelt - ((left - array) / esize), esize, cmp, ctx);
     return base;
 }
 
@@ -17525,6 +17910,28 @@ PUBLIC char *mprSearchForModule(cchar *filename)
 
 #define defaultSep(fs)          (fs->separators[0])
 
+/*
+    Kernel assisted file copies. FICLONE shares the source extents on copy-on-write file systems (btrfs, xfs).
+ */
+#if LINUX
+    #ifndef FICLONE
+        #define FICLONE _IOW(0x94, 9, int)
+    #endif
+    #if defined(__GLIBC__)
+        #if __GLIBC_PREREQ(2, 27)
+            #define MPR_COPY_FILE_RANGE 1
+        #endif
+    #endif
+    #if !__UCLIBC__
+        #define MPR_COPY_SENDFILE 1
+    #endif
+#endif
+
+/*
+    Maximum bytes to request per kernel copy call
+ */
+#define MPR_COPY_CHUNK          (1024 * 1024 * 1024)
+
 /*********************************** Forwards *********************************/
 
 static MprList *globPathFiles(MprList *results, cchar *path, cchar *pattern, cchar *relativeTo, cchar *exclude, int flags);
@@ -17661,27 +18068,109 @@ static ME_INLINE char *lastSep(MprFileSystem *fs, cchar *path)
 }
 
 /************************************ Code ************************************/
+
+#if !ME_ROM
 /*
-    This copies a file.
+    Copy file contents between descriptors. Try a reflink clone first, then let the kernel copy the data via
+    copy_file_range or sendfile, and finally fall back to read/write. The kernel copies are abandoned if they fail
+    before any data is written (e.g. not supported between these file systems).
+    This does not allocate memory so it may be called from yielded threads.
+ */
+static int copyFileContents(int ifd, int ofd)
+{
+    char    buf[ME_BUFSIZE];
+    ssize   bytes;
+
+#if LINUX
+    if (ioctl(ofd, FICLONE, ifd) == 0) {
+        return 0;
+    }
+#endif
+#if MPR_COPY_FILE_RANGE
+    while ((bytes = copy_file_range(ifd, NULL, ofd, NULL, MPR_COPY_CHUNK, 0)) > 0) { }
+    if (bytes == 0) {
+        return 0;
+    } else if (lseek(ofd, 0, SEEK_CUR) != 0) {
+        return MPR_ERR_CANT_WRITE;
+    }
+#endif
+#if MPR_COPY_SENDFILE
+    while ((bytes = sendfile(ofd, ifd, NULL, MPR_COPY_CHUNK)) > 0) { }
+    if (bytes == 0) {
+        return 0;
+    } else if (lseek(ofd, 0, SEEK_CUR) != 0) {
+        return MPR_ERR_CANT_WRITE;
+    }
+#endif
+    while ((bytes = read(ifd, buf, sizeof(buf))) > 0) {
+        if (write(ofd, buf, (int) bytes) != bytes) {
+            return MPR_ERR_CANT_WRITE;
+        }
+    }
+    return (bytes < 0) ? MPR_ERR_CANT_READ : 0;
+}
+#endif
+
+
+/*
+    This copies a file. This does not allocate memory unless using a ROM file system.
  */
 PUBLIC int mprCopyPath(cchar *fromName, cchar *toName, int mode)
 {
+#if !ME_ROM
+    int     ifd, ofd, rc;
+
+#if ME_WIN_LIKE
+    /* Windows only permits owner bits */
+    mode &= 0600;
+#endif
+    if ((ifd = open(fromName, O_RDONLY | O_BINARY, 0)) < 0) {
+        return MPR_ERR_CANT_OPEN;
+    }
+#if ME_UNIX_LIKE
+    {
+        struct stat     from, to;
+        /* Truncating a hard link to the source would destroy the source */
+        if (fstat(ifd, &from) == 0 && stat(toName, &to) == 0 && from.st_dev == to.st_dev && from.st_ino == to.st_ino) {
+            close(ifd);
+            return 0;
+        }
+    }
+#endif
+    if ((ofd = open(toName, O_WRONLY | O_TRUNC | O_CREAT | O_BINARY, mode)) < 0) {
+        close(ifd);
+        return MPR_ERR_CANT_CREATE;
+    }
+    rc = copyFileContents(ifd, ofd);
+    close(ifd);
+    if (close(ofd) < 0 && rc == 0) {
+        rc = MPR_ERR_CANT_WRITE;
+    }
+    return rc;
+#else
     MprFile     *from, *to;
     ssize       count;
     char        buf[ME_BUFSIZE];
+    int         rc;
 
     if ((from = mprOpenFile(fromName, O_RDONLY | O_BINARY, 0)) == 0) {
         return MPR_ERR_CANT_OPEN;
     }
     if ((to = mprOpenFile(toName, O_WRONLY | O_TRUNC | O_CREAT | O_BINARY, mode)) == 0) {
-        return MPR_ERR_CANT_OPEN;
+        mprCloseFile(from);
+        return MPR_ERR_CANT_CREATE;
     }
+    rc = 0;
     while ((count = mprReadFile(from, buf, sizeof(buf))) > 0) {
-        mprWriteFile(to, buf, count);
+        if (mprWriteFile(to, buf, count) != count) {
+            rc = MPR_ERR_CANT_WRITE;
+            break;
+        }
     }
     mprCloseFile(from);
     mprCloseFile(to);
-    return 0;
+    return rc;
+#endif
 }
 
 
@@ -18958,7 +19447,7 @@ PUBLIC int mprMakeLink(cchar *path, cchar *target, bool hard)
 {
     MprFileSystem   *fs;
 
-    if (mprPathExists(path, X_OK)) {
+    if (mprPathExists(target, F_OK)) {
         return 0;
     }
     fs = mprLookupFileSystem(target);
@@ -21793,6 +22282,9 @@ static MprSocketProvider *createStandardProvider(MprSocketService *ss);
 static void disconnectSocket(MprSocket *sp);
 static ssize flushSocket(MprSocket *sp);
 static int getSocketIpAddr(struct sockaddr *addr, int addrlen, char *ip, int size, int *port);
+#if ME_UNIX_LIKE
+static int getUnixSocketInfo(cchar *path, int *family, int *protocol, struct sockaddr **addr, Socklen *addrlen);
+#endif
 static int ipv6(cchar *ip);
 static void manageSocket(MprSocket *sp, int flags);
 static void manageSocketService(MprSocketService *ss, int flags);
@@ -23154,6 +23646,11 @@ PUBLIC int mprGetSocketInfo(cchar *ip, int port, int *family, int *protocol, str
     assert(addr);
     ss = MPR->socketService;
 
+#if ME_UNIX_LIKE
+    if (ip && *ip == '/') {
+        return getUnixSocketInfo(ip, family, protocol, addr, addrlen);
+    }
+#endif
     lock(ss);
     memset((char*) &hints, '\0', sizeof(hints));
 
@@ -23222,6 +23719,11 @@ PUBLIC int mprGetSocketInfo(cchar *ip, int port, int *family, int *protocol, str
 
     ss = MPR->socketService;
 
+#if ME_UNIX_LIKE
+    if (ip && *ip == '/') {
+        return getUnixSocketInfo(ip, family, protocol, addr, addrlen);
+    }
+#endif
     if ((sa = mprAllocStruct(struct sockaddr_in)) == 0) {
         assert(!MPR_ERR_MEMORY);
         return MPR_ERR_MEMORY;
@@ -23274,6 +23776,32 @@ PUBLIC int mprGetSocketInfo(cchar *ip, int port, int *family, int *protocol, str
 #endif
 
 
+#if ME_UNIX_LIKE
+/*
+    Get a socket address for a Unix domain socket path
+ */
+static int getUnixSocketInfo(cchar *path, int *family, int *protocol, struct sockaddr **addr, Socklen *addrlen)
+{
+    struct sockaddr_un  *sa;
+
+    if ((sa = mprAllocStruct(struct sockaddr_un)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    memset((char*) sa, '\0', sizeof(struct sockaddr_un));
+    if (slen(path) >= sizeof(sa->sun_path)) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    sa->sun_family = AF_UNIX;
+    scopy(sa->sun_path, sizeof(sa->sun_path), path);
+    *addr = (struct sockaddr*) sa;
+    *addrlen = sizeof(struct sockaddr_un);
+    *family = AF_UNIX;
+    *protocol = 0;
+    return 0;
+}
+#endif
+
+
 /*
     Return a numerical IP address and port for the given socket info
  */
@@ -23282,6 +23810,18 @@ static int getSocketIpAddr(struct sockaddr *addr, int addrlen, char *ip, int ipL
 #if (ME_UNIX_LIKE || ME_WIN_LIKE)
     char    service[NI_MAXSERV];
 
+#if ME_UNIX_LIKE
+    if (addr->sa_family == AF_UNIX) {
+        /* Client sockets are unnamed so the path may be empty */
+        ip[0] = '\0';
+        if (addrlen > (int) sizeof(sa_family_t)) {
+            scopy(ip, ipLen, ((struct sockaddr_un*) addr)->sun_path);
+        }
+        *port = 0;
+        return 0;
+    }
+#endif
+
 #if ME_WIN_LIKE || defined(IN6_IS_ADDR_V4MAPPED)
     if (addr->sa_family == AF_INET6) {
         struct sockaddr_in6* addr6 = (struct sockaddr_in6*) addr;
@@ -377,6 +377,7 @@
 #if ME_UNIX_LIKE
     #include    <pthread.h>
     #include    <pwd.h>
+    #include    <sys/un.h>
 #if !CYGWIN
     #include    <resolv.h>
 #endif
@@ -33,6 +33,10 @@ enumerable class TestMe {
     var startTest
     var verbosity: Number = 0
 
+    var assertions: Array = []              //  Assertion results for the current test
+    var results: Array = []                 //  Structured test results for --json and --junit
+    var resultStream: File?                 //  JSON lines result stream for --json
+
     var done: Boolean = false
     var failedCount: Number = 0
     var passedCount: Number = 0
@@ -65,6 +69,8 @@ enumerable class TestMe {
             debug: { alias: 'D' },
             depth: { range: Number, alias: 'd' },
             ide: { alias: 'i' },
+            json: { range: Path },
+            junit: { range: Path },
             log: { alias: 'l', range: String },
             more: { alias: 'm' },
             noserver: { alias: 'n' },
@@ -93,6 +99,8 @@ enumerable class TestMe {
             '  --debug               # Run in debug mode. Sets TM_DEBUG\n' + 
             '  --depth number        # Zero == basic, 1 == throrough, 2 extensive\n' + 
             '  --ide                 # Run the test in an IDE debugger\n' + 
+            '  --json file           # Write test results as JSON lines to file\n' + 
+            '  --junit file          # Write test results as JUnit XML to file\n' + 
             '  --log file:level      # Log output to file at verbosity level\n' + 
             '  --more                # Pass output through "more"\n' + 
             '  --noserver            # Do not run server side of tests\n' + 
@@ -113,6 +121,13 @@ enumerable class TestMe {
         filters += args.rest
 
         original = App.dir
+        if (options.json) {
+            options.json = options.json.absolute
+            resultStream = File(options.json, 'w')
+        }
+        if (options.junit) {
+            options.junit = options.junit.absolute
+        }
         if (options.chdir) {
             topTest = options.chdir
         }
@@ -358,6 +373,8 @@ enumerable class TestMe {
         }
         let command = file
         let trimmed = file.trimExt()
+        assertions = []
+        this.startTest = null
 
         if (options.clean || options.clobber) {
             clean(topPath, file)
@@ -368,6 +385,7 @@ enumerable class TestMe {
         } catch (e) {
             trace('FAIL', topPath + ' cannot build ' + topPath + '\n\n' + e.message)
             this.failedCount++
+            record(phase, topPath, 'fail', 'Cannot build: ' + e.message)
             return false
         }
         if (file.extension == 'tst' && trimmed.extension == 'c') {
@@ -395,6 +413,8 @@ enumerable class TestMe {
             }
         }
         let prior = this.failedCount
+        let priorSkipped = this.skippedCount
+        let message
         if (command) {
             try {
                 App.log.debug(6, serialize(env))
@@ -406,6 +426,7 @@ enumerable class TestMe {
                 cmd.finalize()
                 cmd.wait(TIMEOUT)
                 if (cmd.status != 0) {
+                    message = 'Bad exit status ' + cmd.status
                     trace('FAIL', topPath + ' with bad exit status ' + cmd.status)
                     if (cmd.error) {
                         trace('Stderr', '\n' + cmd.error)
@@ -422,13 +443,22 @@ enumerable class TestMe {
                     }
                 }
             } catch (e) {
+                message = '' + e
                 trace('FAIL', topPath + ' ' + e)
                 this.failedCount++
             }
         } else {
+            message = 'Not a valid test file'
             trace('FAIL', topPath + ' is not a valid test file')
             this.failedCount++
         }
+        if (prior != this.failedCount) {
+            record(phase, topPath, 'fail', message)
+        } else if (priorSkipped != this.skippedCount) {
+            record(phase, topPath, 'skip')
+        } else {
+            record(phase, topPath, 'pass')
+        }
         if (prior == this.failedCount) {
             if (phase == 'Test') {
                 trace('Pass', topPath)
@@ -456,6 +486,7 @@ enumerable class TestMe {
             case 'fail':
                 success = false
                 this.failedCount++
+                assertion('fail', rest)
                 trace('FAIL', topPath + ' ' + rest)
                 break
 
@@ -464,6 +495,7 @@ enumerable class TestMe {
                     success = true
                 }
                 this.passedCount++
+                assertion('pass', rest)
                 break
 
             case 'info':
@@ -485,6 +517,7 @@ enumerable class TestMe {
             case 'skip':
                 success = true
                 skippedCount++
+                assertion('skip', rest)
                 skipTest = true
                 if (true || options.verbose || options.why) {
                     if (file.extension == 'set') {
@@ -525,6 +558,87 @@ enumerable class TestMe {
         }
     }
 
+    /*
+        Capture an assertion result. C tests emit "pass in file@line for \"expression\"" and
+        ejs tests emit "pass file@line for expression".
+     */
+    function assertion(status: String, rest: String) {
+        let result = { status: status }
+        let matches = rest.match(/^(in )?([^ ]+@[0-9]+) for (.*)$/)
+        if (matches) {
+            result.location = matches[2]
+            result.expression = matches[3].replace(/^"|"$/g, '')
+        } else if (rest) {
+            result.message = rest
+        }
+        assertions.push(result)
+    }
+
+    /*
+        Record the result of a test file. Emitted immediately to the --json stream and saved for --junit.
+     */
+    function record(phase, topPath: Path, status: String, message: String? = null) {
+        let result = {
+            test: topPath.portable.toString(),
+            phase: phase,
+            status: status,
+            elapsed: this.startTest ? (this.startTest.elapsed / 1000) : 0,
+            assertions: assertions,
+        }
+        if (message) {
+            result.message = message
+        }
+        results.push(result)
+        if (resultStream) {
+            resultStream.write(serialize(result) + '\n')
+            resultStream.flush()
+        }
+        assertions = []
+    }
+
+    function xmlEscape(s): String
+        ('' + s).replace(/&/g, '&amp;').replace(/</g, '&lt;').replace(/>/g, '&gt;').replace(/"/g, '&quot;')
+
+    /*
+        Write the accumulated results as a JUnit XML report. Setup and finalize phases are only reported if they fail.
+     */
+    function writeJUnit(path: Path) {
+        let cases = results.filter(function(r) r.phase == 'Test' || r.status == 'fail')
+        let failures = cases.filter(function(r) r.status == 'fail').length
+        let skipped = cases.filter(function(r) r.status == 'skip').length
+        let elapsed = (Date.now() - start) / 1000
+        let out = TextStream(File(path, 'w'))
+        out.writeLine('<?xml version="1.0" encoding="UTF-8"?>')
+        out.writeLine('<testsuites name="testme" tests="' + cases.length + '" failures="' + failures +
+            '" skipped="' + skipped + '" time="' + ('%.3f' % elapsed) + '">')
+        out.writeLine('  <testsuite name="testme" tests="' + cases.length + '" failures="' + failures +
+            '" skipped="' + skipped + '" time="' + ('%.3f' % elapsed) + '">')
+        for each (r in cases) {
+            let test = Path(r.test)
+            let name = (r.phase == 'Test') ? test.basename : (r.phase + ' ' + test.basename)
+            out.write('    <testcase classname="' + xmlEscape(test.dirname.portable) + '" name="' + xmlEscape(name) +
+                '" time="' + ('%.3f' % r.elapsed) + '">')
+            if (r.status == 'fail') {
+                let failed = r.assertions.filter(function(a) a.status == 'fail')
+                if (failed.length == 0) {
+                    out.write('\n      <failure type="error" message="' + xmlEscape(r.message || 'Test failed') + '"/>')
+                }
+                for each (a in failed) {
+                    let msg = a.location ? (a.location + ' for ' + a.expression) : (a.message || 'Assertion failed')
+                    out.write('\n      <failure type="assertion" message="' + xmlEscape(msg) + '"/>')
+                }
+                out.write('\n    ')
+            } else if (r.status == 'skip') {
+                let skip = r.assertions.find(function(a) a.status == 'skip')
+                out.write('\n      <skipped message="' + xmlEscape((skip && skip.message) || '') + '"/>\n    ')
+            }
+            out.writeLine('</testcase>')
+        }
+        out.writeLine('  </testsuite>')
+        out.writeLine('</testsuites>')
+        out.close()
+    }
+
     function createMakeMe(file: Path, env) {
         let name = file.trimExt().trimExt()
         let tm = Path('testme')
@@ -722,6 +836,15 @@ Me.load({
                 skippedCount + ' tests(s) skipped. ' + 
                 'Elapsed time ' + ('%.2f' % ((Date.now() - start) / 1000)) + ' secs.')
         }
+        if (resultStream) {
+            resultStream.write(serialize({summary: true, failed: failedCount, tests: testCount, 
+                skipped: skippedCount, elapsed: (Date.now() - start) / 1000}) + '\n')
+            resultStream.close()
+            resultStream = null
+        }
+        if (options.junit) {
+            writeJUnit(options.junit)
+        }
     }
 
     function exit() {
@@ -0,0 +1,50 @@
+/*
+    unique.es.tst - Test that Array.appendUnique keeps its index in step with changes to the array
+ */
+
+require ejs.testme
+
+let a = ['one', 'two']
+a.appendUnique(['two', 'three'])
+ttrue(a.join(',') == 'one,two,three')
+
+/* Appends reuse the index */
+a.appendUnique(['three', 'four', 'four'])
+ttrue(a.join(',') == 'one,two,three,four')
+
+/* Removed and replaced elements may be appended again */
+a.pop()
+a.appendUnique(['four'])
+ttrue(a.join(',') == 'one,two,three,four')
+
+a.splice(0, 1)
+a.appendUnique(['one'])
+ttrue(a.join(',') == 'two,three,four,one')
+
+a[0] = 'five'
+a.appendUnique(['two', 'five'])
+ttrue(a.join(',') == 'five,three,four,one,two')
+
+a.length = 1
+a.appendUnique(['three'])
+ttrue(a.join(',') == 'five,three')
+
+a.push('six')
+a.appendUnique(['six', 'seven'])
+ttrue(a.join(',') == 'five,three,six,seven')
+
+a.clear()
+a.appendUnique(['five'])
+ttrue(a.join(',') == 'five')
+
+/* Paths compare by value and numbers by value */
+let p = [Path('a'), 1]
+p.appendUnique([Path('a'), Path('b'), 1, 2])
+ttrue(p.length == 4)
+
+/* Grow well past the initial index size */
+let big = []
+for (let i = 0; i < 2000; i++) {
+    big.appendUnique([i, i + 1])
+}
+ttrue(big.length == 2001)
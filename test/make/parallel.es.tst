@@ -0,0 +1,54 @@
+/*
+    parallel.es.tst - Test that generated Makefiles build with make -j and are then up to date
+ */
+
+require ejs.testme
+
+if (Config.OS == 'windows' || !Cmd.locate('make')) {
+    tskip('Requires make')
+}
+
+let dir = Path(App.getenv('TMPDIR') || '/tmp').join('me-parallel-' + App.pid)
+
+/*
+    Run make -j on the generated Makefile. Returns the output lines other than informational messages.
+ */
+function make(): Array {
+    let makefile = dir.files('projects/*.mk')[0]
+    let output = Cmd.run(['make', '-j8', '-f', makefile.relativeTo(dir)], {dir: dir})
+    return output.split('\n').filter(function(line) line.trim() && !line.contains('[Info]'))
+}
+
+try {
+    dir.join('src').makeDir()
+    dir.join('main.me').write("Me.load({\n" +
+        "    settings: { name: 'pm', title: 'Parallel', description: 'Parallel make', company: 'test', version: '1.0.0' },\n" +
+        "    targets: {\n" +
+        "        libpm: { type: 'lib', sources: [ 'src/util*.c' ], headers: [ 'src/*.h' ] },\n" +
+        "        pm: { type: 'exe', sources: [ 'src/main.c' ], depends: [ 'libpm' ] },\n" +
+        "    },\n" +
+        "})\n")
+    dir.join('src/util.h').write('int util1(void);\n')
+    for (let i = 1; i <= 8; i++) {
+        dir.join('src/util' + i + '.c').write('#include "util.h"\nint util' + i + '(void) { return ' + i + '; }\n')
+    }
+    dir.join('src/main.c').write('#include "util.h"\nint main(void) { return util1() - 1; }\n')
+
+    Cmd.run('me -configure .', {dir: dir})
+    Cmd.run('me --gen make', {dir: dir})
+    /* Generating also builds with me, so start make from a clean tree */
+    dir.join('build').removeAll()
+
+    /* The first build creates everything and the second must have nothing to do */
+    ttrue(make().length > 0)
+    ttrue(make().length == 0)
+
+    /* A changed header is exported and rebuilds the dependent objects only once */
+    dir.join('src/util.h').write('int util1(void);\nint util2(void);\n')
+    let rebuilt = make()
+    ttrue(rebuilt.filter(function(line) line.contains('[Copy]')).length == 1)
+    ttrue(rebuilt.filter(function(line) line.contains('[Compile]')).length == 9)
+    ttrue(make().length == 0)
+} finally {
+    dir.removeAll()
+}
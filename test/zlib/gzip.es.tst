@@ -0,0 +1,55 @@
+/*
+    gzip.es.tst - Test that parallel gzip output does not depend on the number of threads
+ */
+
+require ejs.testme
+require ejs.zlib
+
+let dir = Path(App.getenv('TMPDIR') || '/tmp').join('me-gzip-' + App.pid)
+
+/*
+    Sizes around the 128K block size and exact multiples of several thread counts
+ */
+const Block = 128 * 1024
+let sizes = [0, 1, Block - 1, Block, Block * 2, Block * 3, Block * 4, Block * 8, Block * 6 + 5]
+
+function sameBytes(a: ByteArray, b: ByteArray): Boolean {
+    if (a.length != b.length) {
+        return false
+    }
+    for (let i = 0; i < a.length; i++) {
+        if (a[i] != b[i]) {
+            return false
+        }
+    }
+    return true
+}
+
+try {
+    dir.makeDir()
+    for each (size in sizes) {
+        let data = new ByteArray(size + 1)
+        for (let i = 0; i < size; i++) {
+            data.writeByte((i * 7 + (i >> 9)) & 0xff)
+        }
+        let expected = null
+        for each (threads in [2, 3, 4, 8]) {
+            let path = dir.join('data-' + threads + '.gz')
+            let gz = new GzipStream(path, {threads: threads})
+            data.readPosition = 0
+            gz.write(data)
+            gz.close()
+
+            let compressed = path.readBytes()
+            if (expected == null) {
+                expected = compressed
+            }
+            ttrue(sameBytes(compressed, expected))
+
+            Zlib.uncompress(path, dir.join('data'))
+            ttrue(dir.join('data').size == size)
+        }
+    }
+} finally {
+    dir.removeAll()
+}